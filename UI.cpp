@@ -5,14 +5,28 @@
 #include <limits>
 #include <ctime>
 #include <iomanip>
+#include <algorithm>
+#include <vector>
 #include "ui.h"
 #include "vehicle_io.h"
 #include "reservation.h"
 #include "vessel.h"
 #include "sailing.h"
+#include "sailing_io.h"
+#include "analytics.h"
+#include "revenue.h"
+#include "stats.h"
+#include "trace.h"
+#include "archive.h"
+#include "reassign.h"
+#include "checkpoint.h"
 
 using namespace std;
 
+// main() calls shutdown() again after the menu's own call; only the first
+// one may write the checkpoint, while the subsystems still hold their state
+static bool running = false;
+
 void UserInterface::clearInput() {
     // clear any error state, then drop the rest of the line
     cin.clear();
@@ -20,14 +34,44 @@ void UserInterface::clearInput() {
 }
 
 bool UserInterface::startup() {
-    Vessel::init();
-    Sailing::init();
-    Reservation::init();
-    Vehicle::init();
+    Stats::initFromEnvironment();
+    Trace::initFromEnvironment();
+    // indexes come from the checkpoint where their files are unchanged
+    Checkpoint::open();
+    bool opened = Vessel::init() && Sailing::init() && Reservation::init() && Vehicle::init();
+    Checkpoint::close();
+    if (!opened) {
+        // the file's own error is printed above; without the file every
+        // menu option would fail, so stop before one is offered
+        cerr << "Error: cannot open the data files. Files written by an older "
+                "version are converted with setsail_migrate.\n";
+        Trace::stop();
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        return false;
+    }
+    Archive::initFromEnvironment();
+    running = true;
     return true;
 }
 
 bool UserInterface::shutdown() {
+    if (!running) return true;
+    running = false;
+    // dump collected statistics once, then stop collecting
+    if (Stats::isEnabled()) {
+        cout << "\n===== Performance Statistics =====\n";
+        Stats::printReport(cout);
+        Stats::setEnabled(false);
+    }
+    Trace::stop();
+    Archive::close();
+    // the checkpoint is built from the subsystems' in-memory state, so it
+    // comes before they shut down; it flushes each data file before
+    // stamping it, leaving nothing for the closes below to write
+    Checkpoint::write();
     Sailing::shutdown();
     Reservation::shutdown();
     Vehicle::shutdown();
@@ -50,6 +94,9 @@ void UserInterface::displayMainMenu() {
          << "   -  Vehicles_on_board\n"
          << "   -  Log_arrivals\n"
          << "[5] Print Sailing Report\n"
+         << "[6] Fleet Utilisation Report\n"
+         << "[7] Revenue Report\n"
+         << "[8] Performance Statistics\n"
          << "========================\n"
          << "[0] Shutdown\n\n";
 }
@@ -180,6 +227,8 @@ void UserInterface::chooseSailing() {
     cout << "\n===== Sailings ========\n"
          << "[1] Create_sailing\n"
          << "[2] Delete_sailing\n"
+         << "[3] Cancel_sailing\n"
+         << "[4] Substitute_vessel\n"
          << "=======================\n"
          << "[0] Return to main menu\n\n";
 
@@ -256,8 +305,73 @@ void UserInterface::chooseSailing() {
 
             return;
 
+        } else if (choice == 3) {
+            string sailingID;
+            cout << "Enter sailing ID of sailing to be cancelled: ";
+            getline(cin, sailingID);
+            string terminal;
+            int day, hour;
+            if (sailingID.empty() || !Sailing::parseSailingID(sailingID, terminal, day, hour)) {
+                cout << "Invalid sailing ID.\n";
+                return;
+            }
+
+            // alternatives in order of preference; by default every sailing
+            // that day or the next with room for a regular vehicle
+            cout << "Enter alternative sailing IDs separated by commas\n"
+                 << "(leave blank for sailings on day " << day << " or the next): ";
+            string line;
+            getline(cin, line);
+            vector<string> alternatives;
+            string id;
+            for (char c : line + ",") {
+                if (c == ',') {
+                    if (!id.empty()) alternatives.push_back(id);
+                    id.clear();
+                } else if (c != ' ') {
+                    id += c;
+                }
+            }
+            if (alternatives.empty())
+                alternatives = Sailing::findSailingsWithRoom(0, Reservation::REGULAR_LENGTH_CM, 1,
+                                                             day, min(day + 1, 31));
+
+            cout << "Are you sure you wish to cancel " << sailingID << " and move its "
+                 << "reservations to " << alternatives.size() << " sailing(s)? [Y/N] ";
+            char decision;
+            cin >> decision;
+            clearInput();
+            if (decision != 'Y' && decision != 'y') {
+                cout << "Sailing not cancelled.\n";
+                return;
+            }
+            Reassignment::Outcome outcome;
+            if (Reassignment::cancelSailing(sailingID, alternatives, outcome))
+                Reassignment::printOutcome(sailingID, outcome, cout);
+            else
+                cout << "Sailing not found or its reservations could not be moved.\n";
+            return;
+
+        } else if (choice == 4) {
+            string sailingID, vesselName;
+            cout << "Enter sailing ID of sailing to change vessel: ";
+            getline(cin, sailingID);
+            cout << "Enter name of vessel to put on it: ";
+            getline(cin, vesselName);
+            if (sailingID.empty() || vesselName.empty()) {
+                cout << "Invalid sailing ID or vessel name.\n";
+                return;
+            }
+            Reassignment::Substitution result;
+            if (Reassignment::substituteVessel(sailingID, vesselName, result)
+             || !result.overflow.empty() || result.passengerOverflow > 0)
+                Reassignment::printSubstitution(sailingID, vesselName, result, cout);
+            else
+                cout << "Sailing or vessel not found, or the change could not be written.\n";
+            return;
+
         } else {
-            cout << "Invalid selection. Please enter 1, 2, or 0 to return.\n";
+            cout << "Invalid selection. Please enter 1, 2, 3, 4, or 0 to return.\n";
         }
     }
 }
@@ -267,6 +381,8 @@ void UserInterface::chooseReservation() {
     cout << "\n===== Reservations ====\n"
          << "[1] Create_reservation\n"
          << "[2] Cancel_reservation\n"
+         << "[3] Find_by_phone\n"
+         << "[4] Rebook_reservation\n"
          << "=======================\n"
          << "[0] Return to main menu\n\n";
 
@@ -394,6 +510,8 @@ else if (choice == 1) {
               storedH =  2.0f;
               storedL =  7.0f;
           }
+          height = storedH;
+          length = storedL;
           success = Reservation::createSpecialReservation(
               sailingID,
               vehicleLicense,
@@ -405,6 +523,8 @@ else if (choice == 1) {
       }
       else {
           // an existing regular vehicle
+          height = 2.0f;
+          length = 7.0f;
           success = Reservation::createReservation(
               sailingID,
               vehicleLicense,
@@ -416,6 +536,7 @@ else if (choice == 1) {
       std::cout << (success
                     ? "Reservation successfully created.\n"
                     : "Reservation creation failed.\n");
+      if (!success) suggestSailings(sailingID, occupants, height, length);
     return;
 }
  else if (choice == 2) {
@@ -454,8 +575,48 @@ else if (choice == 1) {
             }
             return;
 
+        } else if (choice == 3) {
+            string phone;
+            do {
+                cout << "Enter the caller's phone number: ";
+                getline(cin, phone);
+                if (phone.empty()) cout << "Invalid phone number.\n";
+                else break;
+            } while (true);
+
+            if (!Reservation::printBookingsForPhone(phone))
+                cout << "No vehicle is registered to " << phone << ".\n";
+            return;
+
+        } else if (choice == 4) {
+            string vehicleLicense, fromSailingID, toSailingID;
+            do {
+                cout << "Enter vehicle license: ";
+                getline(cin, vehicleLicense);
+                if (vehicleLicense.empty()) cout << "Invalid license.\n";
+                else break;
+            } while (true);
+            do {
+                cout << "Enter the sailing ID it is booked on: ";
+                getline(cin, fromSailingID);
+                if (fromSailingID.empty()) cout << "Invalid sailing ID.\n";
+                else break;
+            } while (true);
+            do {
+                cout << "Enter the sailing ID to move it to: ";
+                getline(cin, toSailingID);
+                if (toSailingID.empty()) cout << "Invalid sailing ID.\n";
+                else break;
+            } while (true);
+
+            if (Reservation::rebookReservation(vehicleLicense, fromSailingID, toSailingID))
+                cout << "Reservation moved to " << toSailingID << ".\n";
+            else
+                cout << "Error: reservation not moved.\n";
+            return;
+
         } else {
-            cout << "Invalid selection. Please enter 1, 2, or 0 to return.\n";
+            cout << "Invalid selection. Please enter 1, 2, 3, 4, or 0 to return.\n";
         }
     }
 }
@@ -530,6 +691,112 @@ void UserInterface::printSailing() {
     Sailing::printSailingReport();
 }
 
+// ALTERNATIVE SAILINGS
+void UserInterface::suggestSailings(const string& sailingID,
+                                    unsigned int occupants,
+                                    float height,
+                                    float length)
+{
+    string terminal;
+    int day, hour;
+    if (!Sailing::parseSailingID(sailingID, terminal, day, hour)) return;
+
+    const size_t maxShown = 10;
+    vector<string> options = Sailing::findSailingsWithRoom(toCentimetres(height),
+                                                           toCentimetres(length), occupants,
+                                                           day, min(day + 1, 31));
+    size_t shown = 0;
+    for (const auto& sid : options) {
+        if (sid == sailingID) continue;
+        if (shown == 0) cout << "Sailings with room for this vehicle:\n";
+        cout << "  " << sid << "\n";
+        if (++shown == maxShown) break;
+    }
+    if (shown == 0) cout << "No other sailings on day " << day
+                         << " or the next day have room for this vehicle.\n";
+}
+
+// FLEET UTILISATION REPORT
+void UserInterface::printUtilisation() {
+    cout << "\n===== Fleet Utilisation Report ==================================================\n";
+    time_t now = time(nullptr);
+    tm* localTime = localtime(&now);
+
+    cout << put_time(localTime, "%B %d %H:%M %Z\n");
+    Analytics::printUtilisationReport();
+}
+
+// REVENUE REPORT
+void UserInterface::printRevenue() {
+    cout << "\n===== Revenue Report ==================================================\n";
+
+    int firstDay, lastDay;
+    do {
+        cout << "Enter first departure day (1-31): ";
+        if (!(cin >> firstDay) || firstDay < 1 || firstDay > 31) {
+            cout << "Invalid day. Please enter a number between 1 and 31.\n";
+            clearInput();
+            continue;
+        }
+        cout << "Enter last departure day (" << firstDay << "-31): ";
+        if (!(cin >> lastDay) || lastDay < firstDay || lastDay > 31) {
+            cout << "Invalid day. Please enter a number between " << firstDay << " and 31.\n";
+            clearInput();
+            continue;
+        }
+        clearInput();
+        break;
+    } while (true);
+
+    RevenueLedger::printRevenueReport(firstDay, lastDay);
+}
+
+// PERFORMANCE STATISTICS
+void UserInterface::chooseStats() {
+    cout << "\n===== Performance Statistics ====\n"
+         << "[1] Show_statistics\n"
+         << "[2] " << (Stats::isEnabled() ? "Disable" : "Enable") << "_collection\n"
+         << "[3] Reset_statistics\n"
+         << "[4] Write_checkpoint\n"
+         << "=================================\n"
+         << "[0] Return to main menu\n\n";
+
+    while (true) {
+        int choice = getChoice();
+
+        if (choice == 0) {
+            return;
+
+        } else if (choice == 1) {
+            if (!Stats::isEnabled())
+                cout << "Collection is currently disabled.\n";
+            Stats::printReport(cout);
+            SailingIO::printCacheReport(cout);
+            return;
+
+        } else if (choice == 2) {
+            Stats::setEnabled(!Stats::isEnabled());
+            cout << "Statistics collection "
+                 << (Stats::isEnabled() ? "enabled" : "disabled") << ".\n";
+            return;
+
+        } else if (choice == 3) {
+            Stats::reset();
+            SailingIO::resetCacheCounters();
+            cout << "Statistics reset.\n";
+            return;
+
+        } else if (choice == 4) {
+            cout << (Checkpoint::write() ? "Checkpoint written.\n"
+                                         : "Checkpoint not written.\n");
+            return;
+
+        } else {
+            cout << "Invalid selection. Please enter 1, 2, 3, 4, or 0 to return.\n";
+        }
+    }
+}
+
 bool UserInterface::interface() {
     while (true) {
         displayMainMenu();
@@ -540,6 +807,9 @@ bool UserInterface::interface() {
             case 3: chooseReservation(); break;
             case 4: checkin(); break;
             case 5: printSailing(); break;
+            case 6: printUtilisation(); break;
+            case 7: printRevenue(); break;
+            case 8: chooseStats(); break;
             case 0: shutdown(); return true;
             default: cout << "Invalid selection. Please choose a valid menu option.\n";
         }
@@ -0,0 +1,233 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// analytics.cpp
+// Description:
+// Implementation of the Analytics class. The three data files are loaded
+// with one sequential read each; reservations and then sailings are split
+// into contiguous ranges, one per worker thread. Each worker fills its own
+// accumulators, so no locking is needed until the final merge.
+//
+// Revision History:
+// Rev. 1 - 2025/08/10 - Team 12
+// - Initial implementation
+//*******************************
+
+#include "analytics.h"
+#include "keys.h"
+#include "sailing.h"
+#include "sailing_io.h"
+#include "vessel_io.h"
+#include "reservation.h"
+#include "reservation_io.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Per-sailing figures gathered from the reservations file
+    struct SailingBookings {
+        int  vehicles  = 0;
+        int  checkedIn = 0;
+        long people    = 0;
+    };
+
+    // Per-thread group-by accumulators
+    struct PartialReport {
+        std::unordered_map<std::string, Analytics::Rollup> byVessel;
+        std::unordered_map<std::string, Analytics::Rollup> byTerminal;
+        std::unordered_map<int, Analytics::Rollup>         byDay;
+        std::unordered_map<int, Analytics::Rollup>         byHour;
+    };
+
+    // Split [0, count) into `threads` contiguous ranges and run fn on each.
+    template <typename Fn>
+    void parallelFor(size_t count, unsigned int threads, Fn fn) {
+        std::vector<std::thread> workers;
+        size_t chunk = (count + threads - 1) / threads;
+        for (unsigned int t = 0; t < threads; ++t) {
+            size_t begin = t * chunk;
+            size_t end   = std::min(count, begin + chunk);
+            if (begin >= end) break;
+            workers.emplace_back(fn, t, begin, end);
+        }
+        for (auto& w : workers) w.join();
+    }
+
+    template <typename Map, typename Key>
+    void mergeInto(std::map<Key, Analytics::Rollup>& dst, const Map& src) {
+        for (const auto& kv : src) dst[kv.first].merge(kv.second);
+    }
+
+    std::string percent(double used, double capacity) {
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(2)
+           << (capacity > 0.0 ? used / capacity * 100.0 : 0.0) << '%';
+        return ss.str();
+    }
+
+    template <typename Key>
+    void printTable(const std::string& title,
+                    const std::string& keyHeader,
+                    const std::map<Key, Analytics::Rollup>& rows)
+    {
+        const int w1 = 26, w2 = 10, w3 = 10, w4 = 12, w5 = 12, w6 = 12, w7 = 12;
+        std::cout << "\n" << title << "\n"
+                  << std::left
+                  << std::setw(w1) << keyHeader
+                  << std::setw(w2) << "Sailings"
+                  << std::setw(w3) << "Vehicles"
+                  << std::setw(w4) << "%LaneUsed"
+                  << std::setw(w5) << "%HighUsed"
+                  << std::setw(w6) << "%LowUsed"
+                  << std::setw(w7) << "%PeopleUsed"
+                  << "\n"
+                  << std::string(w1+w2+w3+w4+w5+w6+w7, '=') << "\n";
+        for (const auto& kv : rows) {
+            const Analytics::Rollup& r = kv.second;
+            std::ostringstream key;
+            key << kv.first;
+            std::cout << std::left
+                      << std::setw(w1) << key.str()
+                      << std::setw(w2) << r.sailings
+                      << std::setw(w3) << r.vehicles
+                      << std::setw(w4) << percent(r.laneUsed, r.laneCapacity)
+                      << std::setw(w5) << percent(r.highUsed, r.highCapacity)
+                      << std::setw(w6) << percent(r.lowUsed, r.lowCapacity)
+                      << std::setw(w7) << percent(static_cast<double>(r.peopleBooked),
+                                                  static_cast<double>(r.peopleCapacity))
+                      << "\n";
+        }
+    }
+}
+
+void Analytics::Rollup::merge(const Rollup& other) {
+    sailings       += other.sailings;
+    vehicles       += other.vehicles;
+    checkedIn      += other.checkedIn;
+    laneCapacity   += other.laneCapacity;
+    laneUsed       += other.laneUsed;
+    highCapacity   += other.highCapacity;
+    highUsed       += other.highUsed;
+    lowCapacity    += other.lowCapacity;
+    lowUsed        += other.lowUsed;
+    peopleCapacity += other.peopleCapacity;
+    peopleBooked   += other.peopleBooked;
+}
+
+//------
+// Description:
+// Scans sailings, vessels and reservations once and fills `out` with
+// the utilisation rollups.
+bool Analytics::computeUtilisation(Report& out, unsigned int numThreads) {
+    out = Report();
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 1;
+
+    // 1) One sequential read per file
+    std::vector<Sailing::Record> sailings;
+    std::vector<VesselRecord>    vessels;
+    std::vector<Reservation>     reservations;
+    if (!SailingIO::readAllSailings(sailings)
+     || !VesselIO::readAllVessels(vessels)
+     || !ReservationIO::readAllReservations(reservations))
+    {
+        std::cerr << "Error: Unable to read data files for analytics.\n";
+        return false;
+    }
+
+    std::unordered_map<std::string, const VesselRecord*> vesselByName;
+    for (const auto& v : vessels) vesselByName[v.vesselName] = &v;
+
+    std::unordered_map<SailingKey, size_t> sailingIndex;
+    sailingIndex.reserve(sailings.size());
+    for (size_t i = 0; i < sailings.size(); ++i)
+        sailingIndex[sailings[i].sailingID] = i;
+
+    // 2) Reservations -> per-sailing bookings, one vector per worker
+    std::vector<std::vector<SailingBookings>> partialBookings(
+        numThreads, std::vector<SailingBookings>(sailings.size()));
+    parallelFor(reservations.size(), numThreads,
+        [&](unsigned int t, size_t begin, size_t end) {
+            auto& local = partialBookings[t];
+            for (size_t i = begin; i < end; ++i) {
+                const Reservation& res = reservations[i];
+                auto it = sailingIndex.find(res.currentSailingID);
+                if (it == sailingIndex.end()) continue;
+                SailingBookings& b = local[it->second];
+                b.vehicles  += 1;
+                b.checkedIn += res.checkedIn ? 1 : 0;
+                b.people    += res.currentPeopleOccupants;
+            }
+        });
+
+    std::vector<SailingBookings> bookings(sailings.size());
+    for (const auto& part : partialBookings) {
+        for (size_t i = 0; i < part.size(); ++i) {
+            bookings[i].vehicles  += part[i].vehicles;
+            bookings[i].checkedIn += part[i].checkedIn;
+            bookings[i].people    += part[i].people;
+        }
+    }
+
+    // 3) Sailings -> group-by rollups, one set of maps per worker
+    std::vector<PartialReport> partials(numThreads);
+    parallelFor(sailings.size(), numThreads,
+        [&](unsigned int t, size_t begin, size_t end) {
+            PartialReport& local = partials[t];
+            std::string term;
+            int day = 0, hour = 0;
+            for (size_t i = begin; i < end; ++i) {
+                const Sailing::Record& s = sailings[i];
+                if (!Sailing::parseSailingID(s.sailingID, term, day, hour)) continue;
+
+                Rollup r;
+                r.sailings     = 1;
+                r.vehicles     = bookings[i].vehicles;
+                r.checkedIn    = bookings[i].checkedIn;
+                r.peopleBooked = bookings[i].people;
+
+                auto v = vesselByName.find(s.vessel_ID);
+                if (v != vesselByName.end()) {
+                    const VesselRecord& vr = *v->second;
+                    r.highCapacity   = toMetres(vr.highLaneCm);
+                    r.lowCapacity    = toMetres(vr.lowLaneCm);
+                    r.highUsed       = toMetres(vr.highLaneCm - s.HRL_cm);
+                    r.lowUsed        = toMetres(vr.lowLaneCm  - s.LRL_cm);
+                    r.laneCapacity   = r.highCapacity + r.lowCapacity;
+                    r.laneUsed       = r.highUsed + r.lowUsed;
+                    r.peopleCapacity = vr.maxPassengers;
+                }
+
+                local.byVessel[s.vessel_ID].merge(r);
+                local.byTerminal[term].merge(r);
+                local.byDay[day].merge(r);
+                local.byHour[hour].merge(r);
+            }
+        });
+
+    // 4) Merge per-thread accumulators
+    for (const auto& part : partials) {
+        mergeInto(out.byVessel,   part.byVessel);
+        mergeInto(out.byTerminal, part.byTerminal);
+        mergeInto(out.byDay,      part.byDay);
+        mergeInto(out.byHour,     part.byHour);
+    }
+    return true;
+}
+
+//------
+// Description:
+// Computes and prints the fleet utilisation report.
+void Analytics::printUtilisationReport() {
+    Report report;
+    if (!computeUtilisation(report)) return;
+
+    printTable("Utilisation by Vessel",      "Vessel",   report.byVessel);
+    printTable("Utilisation by Terminal",    "Terminal", report.byTerminal);
+    printTable("Utilisation by Day",         "Day",      report.byDay);
+    printTable("Utilisation by Hour of Day", "Hour",     report.byHour);
+}
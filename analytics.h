@@ -0,0 +1,67 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// analytics.h
+// Description:
+// This class computes fleet utilisation rollups (by vessel, terminal, day
+// and hour-of-day) for capacity planning. Sailings, vessels and
+// reservations are each read once; the work is split across worker threads
+// and the per-thread accumulators are merged before printing.
+//
+// Revision History:
+// Rev. 1 - 2025/08/10 - Team 12
+// - Initial implementation
+//*******************************
+
+#ifndef ANALYTICS_H
+#define ANALYTICS_H
+
+#include <map>
+#include <string>
+
+class Analytics {
+public:
+    // Accumulated utilisation figures for one group (vessel, terminal, ...)
+    struct Rollup {
+        int    sailings       = 0;    // sailings in this group
+        int    vehicles       = 0;    // vehicles booked
+        int    checkedIn      = 0;    // vehicles logged as arrived
+        double laneCapacity   = 0.0;  // total lane metres offered
+        double laneUsed       = 0.0;  // lane metres booked (incl. buffer)
+        double highCapacity   = 0.0;  // high-ceiling lane metres offered
+        double highUsed       = 0.0;  // high-ceiling lane metres booked
+        double lowCapacity    = 0.0;  // low-ceiling lane metres offered
+        double lowUsed        = 0.0;  // low-ceiling lane metres booked
+        long   peopleCapacity = 0;    // sum of vessel maxPassengers
+        long   peopleBooked   = 0;    // passengers on reservations
+
+        void merge(const Rollup& other);
+    };
+
+    // All four rollups produced by a single analytics pass
+    struct Report {
+        std::map<std::string, Rollup> byVessel;
+        std::map<std::string, Rollup> byTerminal;
+        std::map<int, Rollup>         byDay;
+        std::map<int, Rollup>         byHour;
+    };
+
+    //------
+    // Description:
+    // Scans sailings, vessels and reservations once and fills `out` with
+    // the utilisation rollups. Returns false if the data could not be read.
+    // Precondition:
+    // Vessel, Sailing and Reservation subsystems must be initialized
+    static bool computeUtilisation(
+        Report& out,                 // [out] rollups by vessel/terminal/day/hour
+        unsigned int numThreads = 0  // [in] worker threads (0 = hardware)
+    );
+
+    //------
+    // Description:
+    // Computes and prints the fleet utilisation report.
+    // Precondition:
+    // Vessel, Sailing and Reservation subsystems must be initialized
+    static void printUtilisationReport();
+};
+
+#endif // ANALYTICS_H
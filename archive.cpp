@@ -0,0 +1,374 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// archive.cpp
+// Description:
+// Implementation of the Archive class: moving departed sailings and their
+// reservations into archive.dat, and reading them back through the
+// block index.
+//
+// Revision History:
+// Rev. 1 - 2025/08/30 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Only sailings whose bookings are all checked in are archived, one
+//   sailing at a time instead of whole day shards; no "today" mode
+// Rev. 3 - 2025/09/02 - Team 12
+// - An unreadable archive.dat is reported, not recreated
+// Rev. 4 - 2025/09/02 - Team 12
+// - Reservation fields read through Reservation::fields
+//*******************************
+
+#include "archive.h"
+#include "sailing_io.h"
+#include "reservation_io.h"
+#include "revenue.h"
+#include "record_file.h"
+#include "keys.h"
+#include "lz.h"
+#include "stats.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace {
+    const char* const    ARCHIVE_FILE = "archive.dat";
+    const std::streamoff BLOCK_HEADER = RecordSchema<ArchiveBlock>::SIZE;
+    const RecordFile::Format FORMAT   = RecordFile::formatOf<ArchiveBlock>();
+
+    // One committed block and where its header starts
+    struct IndexEntry {
+        ArchiveBlock   block;
+        std::streamoff offset;
+    };
+
+    std::fstream            archiveFile;
+    FileHeader              header;
+    std::vector<IndexEntry> blockIndex;    // committed blocks, in file order
+    std::vector<IndexEntry> pending;       // appended, not yet committed
+    std::streamoff          appendAt = 0;  // end of the last block written
+    uint32_t                lastBatch = 0;
+
+    bool fail(const std::string& why) {
+        std::cerr << "Error: " << ARCHIVE_FILE << ": " << why << "\n";
+        archiveFile.close();
+        blockIndex.clear();
+        pending.clear();
+        return false;
+    }
+
+    // Opens archive.dat and loads the block index by hopping from block
+    // header to block header. A missing archive is empty; it is only
+    // created when `create` is set.
+    bool load(bool create) {
+        if (archiveFile.is_open()) return true;
+        blockIndex.clear();
+        pending.clear();
+        lastBatch = 0;
+
+        std::error_code ec;
+        auto size = std::filesystem::file_size(ARCHIVE_FILE, ec);
+        if (ec && ec != std::errc::no_such_file_or_directory) return fail(ec.message());
+        if (ec || size == 0) {
+            if (!create) return true;
+            archiveFile.open(ARCHIVE_FILE, std::ios::in | std::ios::out | std::ios::binary
+                                         | std::ios::trunc);
+            header = RecordFile::freshHeader(FORMAT);
+            if (!archiveFile || !RecordFile::writeHeader(archiveFile, header)
+             || !archiveFile.flush())
+                return fail("cannot create");
+            appendAt = RecordFile::HEADER_SIZE;
+            return true;
+        }
+
+        archiveFile.open(ARCHIVE_FILE, std::ios::in | std::ios::out | std::ios::binary);
+        if (!archiveFile || !RecordFile::readHeader(archiveFile, header))
+            return fail("no archive header");
+        std::string problem = RecordFile::validate(header, FORMAT, -1);
+        if (!problem.empty()) return fail(problem);
+
+        std::streamoff pos = RecordFile::HEADER_SIZE;
+        const std::streamoff end = static_cast<std::streamoff>(size);
+        for (uint32_t i = 0; i < header.liveCount; ++i) {
+            IndexEntry entry;
+            archiveFile.seekg(pos, std::ios::beg);
+            if (pos + BLOCK_HEADER > end || !schema::readRecord(archiveFile, entry.block))
+                return fail("block " + std::to_string(i) + " is missing");
+            STATS_READ(BLOCK_HEADER);
+            entry.offset = pos;
+            pos += BLOCK_HEADER + entry.block.packedSize;
+            if (pos > end) return fail("block " + std::to_string(i) + " is cut short");
+            lastBatch = std::max(lastBatch, entry.block.batch);
+            blockIndex.push_back(entry);
+        }
+        appendAt = pos;
+        return true;
+    }
+
+    // Reads, checks and expands one block into `raw`
+    bool readBlock(const IndexEntry& entry, std::vector<char>& raw) {
+        std::vector<char> packed(entry.block.packedSize);
+        archiveFile.clear();
+        archiveFile.seekg(entry.offset + BLOCK_HEADER, std::ios::beg);
+        if (!archiveFile.read(packed.data(), static_cast<std::streamsize>(packed.size())))
+            return false;
+        STATS_READ(packed.size());
+        if (RecordFile::crc32(packed.data(), packed.size()) != entry.block.checksum) {
+            std::cerr << "Error: " << ARCHIVE_FILE << ": block at " << entry.offset
+                      << " fails its checksum\n";
+            return false;
+        }
+        raw.resize(entry.block.rawSize);
+        return lz::decompress(packed.data(), packed.size(), raw.data(), raw.size());
+    }
+
+    // Makes the pending blocks part of the archive by writing the header
+    bool commitBlocks(uint32_t batch) {
+        if (!archiveFile.flush()) return false;
+        header.liveCount += static_cast<uint32_t>(pending.size());
+        header.meta[0]    = batch;
+        archiveFile.seekp(0, std::ios::beg);
+        if (!RecordFile::writeHeader(archiveFile, header) || !archiveFile.flush())
+            return false;
+        STATS_FLUSH();
+        blockIndex.insert(blockIndex.end(), pending.begin(), pending.end());
+        pending.clear();
+        lastBatch = batch;
+        return true;
+    }
+
+    // Copies an ID into a fixed-width block key
+    void setKey(char (&key)[Sailing::ID_LEN], std::string_view id) {
+        std::memset(key, 0, sizeof key);
+        std::memcpy(key, id.data(), std::min(id.size(), sizeof key - 1));
+    }
+
+    bool covers(const ArchiveBlock& block, std::string_view id) {
+        return fieldView(block.firstKey) <= id && id <= fieldView(block.lastKey);
+    }
+}
+
+std::string_view Archive::keyOf(const Sailing::Record& rec) {
+    return fieldView(rec.sailingID);
+}
+
+std::string_view Archive::keyOf(const Reservation& res) {
+    return res.fields().sailingID;
+}
+
+template <class R>
+bool Archive::appendBlocks(Kind kind, std::vector<R>& records, uint32_t batch) {
+    std::stable_sort(records.begin(), records.end(),
+                     [](const R& a, const R& b) { return keyOf(a) < keyOf(b); });
+
+    const size_t recSize = RecordSchema<R>::SIZE;
+    std::vector<char> raw, packed;
+    for (size_t first = 0; first < records.size(); first += BLOCK_RECORDS) {
+        size_t n = std::min(BLOCK_RECORDS, records.size() - first);
+        raw.resize(n * recSize);
+        for (size_t i = 0; i < n; ++i) schema::encode(records[first + i], raw.data() + i * recSize);
+        packed.clear();
+        lz::compress(raw.data(), raw.size(), packed);
+
+        IndexEntry entry;
+        std::memset(&entry.block, 0, sizeof entry.block);
+        entry.block.kind        = kind;
+        entry.block.recordCount = static_cast<uint32_t>(n);
+        entry.block.rawSize     = static_cast<uint32_t>(raw.size());
+        entry.block.packedSize  = static_cast<uint32_t>(packed.size());
+        entry.block.checksum    = RecordFile::crc32(packed.data(), packed.size());
+        entry.block.batch       = batch;
+        setKey(entry.block.firstKey, keyOf(records[first]));
+        setKey(entry.block.lastKey, keyOf(records[first + n - 1]));
+        entry.offset = appendAt;
+
+        archiveFile.clear();
+        archiveFile.seekp(appendAt, std::ios::beg);
+        schema::writeRecord(archiveFile, entry.block);
+        archiveFile.write(packed.data(), static_cast<std::streamsize>(packed.size()));
+        STATS_WRITE(BLOCK_HEADER + packed.size());
+        if (!archiveFile) return false;
+        appendAt += BLOCK_HEADER + static_cast<std::streamoff>(packed.size());
+        pending.push_back(entry);
+    }
+    return true;
+}
+
+template <class R>
+bool Archive::readBlocks(Kind kind, std::string_view sailingID, std::vector<R>& out) {
+    STATS_SCOPE(ARCHIVE_LOOKUP);
+    if (!load(false)) return false;
+    const size_t recSize = RecordSchema<R>::SIZE;
+    std::vector<char> raw;
+    for (const IndexEntry& entry : blockIndex) {
+        if (entry.block.kind != kind) continue;
+        if (!sailingID.empty() && !covers(entry.block, sailingID)) continue;
+        if (!readBlock(entry, raw) || raw.size() != size_t(entry.block.recordCount) * recSize)
+            return false;
+        R rec;
+        for (size_t i = 0; i < entry.block.recordCount; ++i) {
+            schema::decode(raw.data() + i * recSize, rec);
+            if (sailingID.empty() || keyOf(rec) == sailingID) out.push_back(rec);
+        }
+    }
+    return true;
+}
+
+bool Archive::archiveBefore(int cutoffDay, Moved& moved) {
+    STATS_SCOPE(ARCHIVE_SAILINGS);
+    moved = Moved();
+    cutoffDay = std::min(cutoffDay, int(ReservationIO::SHARD_COUNT));
+    if (cutoffDay <= 1) return true;                  // no day precedes day 1
+
+    // 1) Departed sailings and their reservations. The day number alone
+    //    does not say a sailing has gone (IDs recur every month), so only
+    //    sailings whose bookings are all checked in are taken.
+    std::vector<Sailing::Record> all, departed;
+    std::vector<Reservation> reservations, booked;
+    if (!SailingIO::readAllSailings(all)) return false;
+    for (const Sailing::Record& rec : all) {
+        std::string terminal;
+        int day, hour;
+        if (!Sailing::parseSailingID(fieldView(rec.sailingID), terminal, day, hour)
+         || day < 1 || day >= cutoffDay)
+            continue;
+        if (!ReservationIO::readReservationsForSailing(fieldView(rec.sailingID), booked))
+            return false;
+        bool gone = !booked.empty()
+                 && std::all_of(booked.begin(), booked.end(),
+                                [](const Reservation& res) { return res.fields().checkedIn; });
+        if (!gone) continue;
+        departed.push_back(rec);
+        reservations.insert(reservations.end(), booked.begin(), booked.end());
+    }
+    if (departed.empty()) return true;
+
+    // 2) Append and commit them as one batch before touching the hot files
+    if (!load(true)) return false;
+    uint32_t batch = lastBatch + 1;
+    if (!appendBlocks(RESERVATIONS, reservations, batch)
+     || !appendBlocks(SAILINGS, departed, batch)
+     || !commitBlocks(batch))
+        return fail("cannot append batch " + std::to_string(batch));
+
+    // 3) Drop the hot copies, sailing by sailing, so the rest of each
+    //    day's shard stays where it is
+    std::vector<std::string> ids;
+    ids.reserve(departed.size());
+    for (const Sailing::Record& rec : departed) {
+        ids.emplace_back(fieldView(rec.sailingID));
+        if (!ReservationIO::replaceSailingReservations(ids.back(), {})) return false;
+    }
+    if (!SailingIO::removeSailings(ids)) return false;    // sorted by appendBlocks
+    RevenueLedger::init();
+
+    moved.sailings     = departed.size();
+    moved.reservations = reservations.size();
+    return true;
+}
+
+void Archive::initFromEnvironment() {
+    const char* env = std::getenv("SETSAIL_ARCHIVE_BEFORE");
+    if (!env || !*env) return;
+    int cutoff = std::atoi(env);
+    Moved moved;
+    if (archiveBefore(cutoff, moved) && moved.sailings + moved.reservations > 0)
+        std::cout << "Archived " << moved.sailings << " sailings and "
+                  << moved.reservations << " reservations departing before day "
+                  << cutoff << "\n";
+}
+
+bool Archive::findSailing(std::string_view sailingID, Sailing::Record& out) {
+    std::vector<Sailing::Record> found;
+    if (sailingID.empty() || !readBlocks(SAILINGS, sailingID, found) || found.empty())
+        return false;
+    out = found.back();
+    return true;
+}
+
+bool Archive::readSailings(std::vector<Sailing::Record>& out) {
+    out.clear();
+    return readBlocks(SAILINGS, std::string_view(), out);
+}
+
+bool Archive::readReservations(std::string_view sailingID, std::vector<Reservation>& out) {
+    out.clear();
+    return !sailingID.empty() && readBlocks(RESERVATIONS, sailingID, out);
+}
+
+bool Archive::readAllReservations(std::vector<Reservation>& out) {
+    out.clear();
+    return readBlocks(RESERVATIONS, std::string_view(), out);
+}
+
+void Archive::printArchiveReport(std::ostream& out) {
+    if (!load(false)) return;
+
+    // Per sailing and batch: bookings, check-ins and fares
+    struct Line {
+        int    bookings  = 0;
+        int    checkedIn = 0;
+        double booked    = 0.0;
+    };
+    std::map<std::pair<uint32_t, std::string>, Line> lines;
+    std::vector<char> raw;
+    const size_t recSize = RecordSchema<Reservation>::SIZE;
+    for (const IndexEntry& entry : blockIndex) {
+        if (entry.block.kind != RESERVATIONS || !readBlock(entry, raw)) continue;
+        Reservation res;
+        for (size_t i = 0; i < entry.block.recordCount; ++i) {
+            schema::decode(raw.data() + i * recSize, res);
+            const Reservation::Fields f = res.fields();
+            Line& line = lines[{entry.block.batch, std::string(f.sailingID)}];
+            line.bookings  += 1;
+            line.checkedIn += f.checkedIn ? 1 : 0;
+            line.booked    += f.fare;
+        }
+    }
+
+    const int w1 = 7, w2 = 14, w3 = 26, w4 = 10, w5 = 11, w6 = 12;
+    out << std::left
+        << std::setw(w1) << "Batch"
+        << std::setw(w2) << "Sailing"
+        << std::setw(w3) << "Vessel"
+        << std::setw(w4) << "Bookings"
+        << std::setw(w5) << "CheckedIn"
+        << std::setw(w6) << "Booked($)"
+        << "\n"
+        << std::string(w1+w2+w3+w4+w5+w6, '=') << "\n"
+        << std::fixed << std::setprecision(2);
+
+    std::vector<Sailing::Record> sailings;
+    size_t count = 0;
+    for (const IndexEntry& entry : blockIndex) {
+        if (entry.block.kind != SAILINGS || !readBlock(entry, raw)) continue;
+        Sailing::Record rec;
+        for (size_t i = 0; i < entry.block.recordCount; ++i) {
+            schema::decode(raw.data() + i * RecordSchema<Sailing::Record>::SIZE, rec);
+            const Line& line = lines[{entry.block.batch, std::string(keyOf(rec))}];
+            out << std::left
+                << std::setw(w1) << entry.block.batch
+                << std::setw(w2) << fieldView(rec.sailingID)
+                << std::setw(w3) << fieldView(rec.vessel_ID)
+                << std::setw(w4) << line.bookings
+                << std::setw(w5) << line.checkedIn
+                << std::setw(w6) << line.booked
+                << "\n";
+            ++count;
+        }
+    }
+    out << std::string(w1+w2+w3+w4+w5+w6, '-') << "\n"
+        << count << " archived sailings in " << blockIndex.size() << " blocks\n";
+}
+
+void Archive::close() {
+    archiveFile.close();
+    blockIndex.clear();
+    pending.clear();
+}
@@ -0,0 +1,181 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// archive.h
+// Description:
+// Cold store for departed sailings. archiveBefore() moves the sailings
+// that departed before a cutoff day, together with their reservations,
+// out of the hot files and appends them to archive.dat, so the hot files
+// only hold upcoming sailings. An earlier day of the month may already be
+// booked for next month, so a sailing counts as departed only once it has
+// bookings and all of them are checked in; everything else on that day
+// stays hot.
+//
+// archive.dat is append-only: a RecordFile header (live count = committed
+// blocks) followed by blocks, each an ArchiveBlock header and up to
+// BLOCK_RECORDS records of one kind, sorted by sailing ID and compressed
+// with lz::compress. The block headers double as a sparse index: their
+// first/last sailing IDs are loaded on first use by hopping from header
+// to header, and a lookup by sailing ID decompresses only the blocks
+// whose range covers it. Bytes past the last committed block (an
+// interrupted append) are ignored and overwritten by the next append.
+//
+// Each run is written and committed before the hot copies are removed, so
+// a crash in between leaves those sailings in both places rather than in
+// neither; the next run archives them again under a new batch number.
+// Sailing IDs only carry a day of the month, so an ID can recur across
+// batches; lookups return the most recent.
+//
+// SETSAIL_ARCHIVE_BEFORE=DD runs archiveBefore() once at startup.
+//
+// Revision History:
+// Rev. 1 - 2025/08/30 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Departed means every booking checked in; no "today" mode
+//*******************************
+
+#ifndef ARCHIVE_H
+#define ARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "sailing.h"
+#include "reservation.h"
+#include "schema.h"
+
+// Header of one compressed block in archive.dat
+struct ArchiveBlock {
+    uint32_t kind;                   // Archive::Kind of the records
+    uint32_t recordCount;            // records in the block
+    uint32_t rawSize;                // bytes once decompressed
+    uint32_t packedSize;             // compressed bytes after this header
+    uint32_t checksum;               // CRC-32 of the compressed bytes
+    uint32_t batch;                  // archive run that wrote the block
+    char     firstKey[Sailing::ID_LEN];  // smallest sailing ID in the block
+    char     lastKey[Sailing::ID_LEN];   // largest sailing ID in the block
+};
+
+template <>
+struct RecordSchema<ArchiveBlock> {
+    static constexpr const char*   NAME    = "archive-block";
+    static constexpr uint32_t      VERSION = 1;
+    static constexpr uint32_t      SIZE    = 88;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(ArchiveBlock, kind,        schema::Type::UInt32,  0, 4),
+        SCHEMA_FIELD(ArchiveBlock, recordCount, schema::Type::UInt32,  4, 4),
+        SCHEMA_FIELD(ArchiveBlock, rawSize,     schema::Type::UInt32,  8, 4),
+        SCHEMA_FIELD(ArchiveBlock, packedSize,  schema::Type::UInt32, 12, 4),
+        SCHEMA_FIELD(ArchiveBlock, checksum,    schema::Type::UInt32, 16, 4),
+        SCHEMA_FIELD(ArchiveBlock, batch,       schema::Type::UInt32, 20, 4),
+        SCHEMA_FIELD(ArchiveBlock, firstKey,    schema::Type::Text,   24, 32),
+        SCHEMA_FIELD(ArchiveBlock, lastKey,     schema::Type::Text,   56, 32),
+    };
+};
+static_assert(schema::layoutMatches<ArchiveBlock>(), "ArchiveBlock does not match archive.dat");
+
+class Archive {
+public:
+    enum Kind : uint32_t { SAILINGS = 1, RESERVATIONS = 2 };
+
+    // Records per block: large enough to compress well, small enough
+    // that a lookup decompresses little it does not need
+    static constexpr size_t BLOCK_RECORDS = 512;
+
+    // What one archiveBefore() call moved
+    struct Moved {
+        size_t sailings     = 0;
+        size_t reservations = 0;
+    };
+
+    //------
+    // Description:
+    // Moves every departed sailing of days 1..cutoffDay-1, and its
+    // reservations, into the archive. A sailing has departed when it has
+    // reservations and every one is checked in; the others stay in the
+    // hot files. Returns true if successful; `moved` says how much went.
+    // Precondition:
+    // Vessel, Sailing and Reservation subsystems initialised
+    static bool archiveBefore(
+        int cutoffDay,  // [in] First day that stays hot (2-32)
+        Moved& moved    // [out] Sailings and reservations archived
+    );
+
+    //------
+    // Description:
+    // Applies SETSAIL_ARCHIVE_BEFORE if it is set to a day number.
+    // Precondition:
+    // Vessel, Sailing and Reservation subsystems initialised
+    static void initFromEnvironment();
+
+    //------
+    // Description:
+    // Copies the most recently archived sailing with this ID into `out`.
+    // Returns false if there is none.
+    // Precondition:
+    // None
+    static bool findSailing(
+        std::string_view sailingID,  // [in] Sailing to look up
+        Sailing::Record& out         // [out] Archived record
+    );
+
+    //------
+    // Description:
+    // Reads every archived sailing into `out`, oldest batch first.
+    // Precondition:
+    // None
+    static bool readSailings(std::vector<Sailing::Record>& out);
+
+    //------
+    // Description:
+    // Reads the archived reservations of one sailing into `out`, reading
+    // only the blocks whose ID range covers it.
+    // Precondition:
+    // None
+    static bool readReservations(
+        std::string_view sailingID,    // [in] Sailing to look up
+        std::vector<Reservation>& out  // [out] Its archived reservations
+    );
+
+    //------
+    // Description:
+    // Reads every archived reservation into `out`, oldest batch first.
+    // Precondition:
+    // None
+    static bool readAllReservations(std::vector<Reservation>& out);
+
+    //------
+    // Description:
+    // Prints one line per archived sailing: batch, vessel, bookings,
+    // check-ins and fares.
+    // Precondition:
+    // None
+    static void printArchiveReport(std::ostream& out);
+
+    //------
+    // Description:
+    // Closes archive.dat and drops the loaded block index.
+    // Precondition:
+    // None
+    static void close();
+
+private:
+    // Sailing ID a record is sorted and indexed by
+    static std::string_view keyOf(const Sailing::Record& rec);
+    static std::string_view keyOf(const Reservation& res);
+
+    // Sorts `records` by key, then appends them as blocks of `kind`
+    // (uncommitted until commitBlocks)
+    template <class R>
+    static bool appendBlocks(Kind kind, std::vector<R>& records, uint32_t batch);
+
+    // Decodes the blocks of `kind` whose range covers `sailingID` (every
+    // block of that kind if it is empty), keeping matching records
+    template <class R>
+    static bool readBlocks(Kind kind, std::string_view sailingID, std::vector<R>& out);
+};
+
+#endif // ARCHIVE_H
@@ -0,0 +1,125 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// archiveTest.cpp
+// Description:
+// Unit test driver for the cold archive. Books a few sailings, archives
+// the departed ones and reads them back after archive.dat is closed and
+// reopened.
+//
+// Test Case:
+// 1. Only sailings before the cutoff whose bookings are all checked in
+//    are moved; they leave the hot files and the rest stay
+// 2. After a reopen, findSailing and readReservations return what was
+//    archived, and an unarchived sailing is not found
+// 3. A second run appends a new batch and both batches are readable
+// 4. Bytes left by an interrupted append are ignored on reopen
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+//*******************************
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "archive.h"
+#include "reservation_io.h"
+#include "vehicle.h"
+#include "vessel.h"
+
+namespace {
+    bool fail(const std::string& why) {
+        std::cerr << why << "\n";
+        Archive::close();
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        return false;
+    }
+
+    bool book(std::string_view sailingID, std::string_view license, bool checkIn) {
+        return Reservation::createReservation(sailingID, license, 2, "604-555-0100")
+            && (!checkIn || Reservation::logArrivals(sailingID, license));
+    }
+
+    bool run() {
+        if (!Vessel::init() || !Sailing::init() || !Reservation::init() || !Vehicle::init())
+            return fail("cannot create the data files");
+        if (!Vessel::createVessel("Coastal", 200, 50.0f, 50.0f)
+         || !Sailing::createSailing("Coastal", "AAA", "01", "08")
+         || !Sailing::createSailing("Coastal", "AAA", "01", "09")
+         || !Sailing::createSailing("Coastal", "AAA", "02", "08")
+         || !Sailing::createSailing("Coastal", "AAA", "05", "08"))
+            return fail("cannot create the sailings");
+        if (!book("AAA-01-08", "ARC1", true) || !book("AAA-01-08", "ARC2", true)
+         || !book("AAA-01-09", "ARC3", false)
+         || !book("AAA-05-08", "ARC4", true))
+            return fail("cannot book the sailings");
+
+        // Test 1: AAA-01-09 has a booking not checked in, AAA-02-08 has
+        //         none and AAA-05-08 is not before the cutoff
+        Archive::Moved moved;
+        if (!Archive::archiveBefore(3, moved)) return fail("archiveBefore failed");
+        if (moved.sailings != 1 || moved.reservations != 2)
+            return fail("first run moved " + std::to_string(moved.sailings) + " sailings and "
+                        + std::to_string(moved.reservations) + " reservations");
+        std::vector<Reservation> hot;
+        if (Sailing::checkSailingExists("AAA-01-08")
+         || !ReservationIO::readReservationsForSailing("AAA-01-08", hot) || !hot.empty())
+            return fail("AAA-01-08 is still in the hot files");
+        for (const char* id : {"AAA-01-09", "AAA-02-08", "AAA-05-08"}) {
+            if (!Sailing::checkSailingExists(id)) return fail(std::string(id) + " was archived");
+        }
+
+        // Test 2: Read back through a fresh block index
+        Archive::close();
+        Sailing::Record rec;
+        std::vector<Reservation> archived;
+        if (!Archive::findSailing("AAA-01-08", rec) || fieldView(rec.vessel_ID) != "Coastal"
+         || rec.veh_on_board != 2)
+            return fail("AAA-01-08 not found in the archive");
+        if (!Archive::readReservations("AAA-01-08", archived) || archived.size() != 2
+         || !archived[0].fields().checkedIn || !archived[1].fields().checkedIn)
+            return fail("AAA-01-08's reservations not found in the archive");
+        if (Archive::findSailing("AAA-01-09", rec)) return fail("AAA-01-09 found in the archive");
+
+        // Test 3: Once its last vehicle arrives AAA-01-09 goes in batch 2
+        if (!Reservation::logArrivals("AAA-01-09", "ARC3")
+         || !Archive::archiveBefore(3, moved) || moved.sailings != 1)
+            return fail("second run did not archive AAA-01-09");
+        Archive::close();
+        std::vector<Sailing::Record> sailings;
+        if (!Archive::readSailings(sailings) || sailings.size() != 2
+         || !Archive::readAllReservations(archived) || archived.size() != 3)
+            return fail("both batches not readable");
+
+        // Test 4: A half-written block after the last committed one
+        Archive::close();
+        {
+            std::ofstream tail("archive.dat", std::ios::binary | std::ios::app);
+            tail << std::string(100, '\x7f');
+        }
+        if (!Archive::findSailing("AAA-01-09", rec) || !Archive::readSailings(sailings)
+         || sailings.size() != 2)
+            return fail("interrupted append broke the archive");
+
+        Archive::close();
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        return true;
+    }
+}
+
+//------
+// Description:
+// Main test driver function
+int archiveTest() {
+    std::cout << "Starting archive test...\n";
+    if (!run()) return 1;
+    std::cout << "Archive test: Pass\n";
+    return 0;
+}
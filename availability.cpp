@@ -0,0 +1,294 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// availability.cpp
+// Description:
+// Implementation of the AvailabilityTable class. The hot columns are
+// plain int32 vectors so the filter kernel can load 4 or 8 rows per
+// instruction; sailing IDs live in a separate cold column and are only
+// touched for rows that match.
+//
+// Revision History:
+// Rev. 1 - 2025/08/22 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/25 - Team 12
+// - Lane columns in centimetres; all compares are integer
+// Rev. 3 - 2025/08/31 - Team 12
+// - Checkpoint save and restore, one memcpy per column
+// Rev. 4 - 2025/09/02 - Team 12
+// - Passenger capacity refreshed when a sailing changes vessel
+// Rev. 5 - 2025/09/02 - Team 12
+// - Low-lane height limit taken from Reservation
+// Rev. 6 - 2025/09/02 - Team 12
+// - idAt
+// Rev. 7 - 2025/09/02 - Team 12
+// - findSailingsWithRoom bounds each ID by its field width
+//*******************************
+
+#include "availability.h"
+#include "reservation.h"
+#include "sailing_io.h"
+#include "vessel_io.h"
+#include "checkpoint.h"
+#include <array>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace {
+    const int32_t NO_KEY = std::numeric_limits<int32_t>::max();
+
+    // Hot columns, one entry per record of sailings.dat
+    std::vector<int32_t> highRem;     // HRL_cm
+    std::vector<int32_t> lowRem;      // LRL_cm
+    std::vector<int32_t> peopleRem;   // maxPassengers - ppl_on_board
+    std::vector<int32_t> departKey;   // (day - 1) * 24 + hour, NO_KEY if unparseable
+    std::vector<int32_t> maxPeople;   // vessel maxPassengers, kept for updates
+
+    // Cold column
+    std::vector<std::array<char, Sailing::ID_LEN>> ids;
+
+    int32_t keyFor(const char* sailingID) {
+        std::string term;
+        int day = 0, hour = 0;
+        if (!Sailing::parseSailingID(sailingID, term, day, hour)) return NO_KEY;
+        return (day - 1) * 24 + hour;
+    }
+
+    void setRow(size_t i, const Sailing::Record& rec, int maxPassengers) {
+        highRem[i]   = rec.HRL_cm;
+        lowRem[i]    = rec.LRL_cm;
+        maxPeople[i] = maxPassengers;
+        peopleRem[i] = maxPassengers - rec.ppl_on_board;
+        departKey[i] = keyFor(rec.sailingID);
+        std::memcpy(ids[i].data(), rec.sailingID, Sailing::ID_LEN);
+    }
+
+    // Hot columns in checkpoint order
+    std::vector<int32_t>* const intColumns[] = {
+        &highRem, &lowRem, &peopleRem, &departKey, &maxPeople
+    };
+
+    void resizeAll(size_t n) {
+        highRem.resize(n);
+        lowRem.resize(n);
+        peopleRem.resize(n);
+        departKey.resize(n);
+        maxPeople.resize(n);
+        ids.resize(n);
+    }
+
+    // Scalar test for one row; also finishes the tail of the vector loops.
+    inline bool rowMatches(size_t i, bool tall, int32_t need, int32_t occ,
+                           int32_t lo, int32_t hi)
+    {
+        bool lane = tall ? highRem[i] >= need
+                         : (lowRem[i] >= need || highRem[i] >= need);
+        return lane && peopleRem[i] >= occ && departKey[i] >= lo && departKey[i] <= hi;
+    }
+
+    // Appends the index of every matching row to `out`.
+    void filter(bool tall, int32_t need, int32_t occ, int32_t lo, int32_t hi,
+                std::vector<size_t>& out)
+    {
+        const size_t n = highRem.size();
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        // x >= v is tested as x > v - 1, the only signed compare SSE2/AVX2 have
+        const __m256i needV = _mm256_set1_epi32(need - 1);
+        const __m256i occV  = _mm256_set1_epi32(occ - 1);
+        const __m256i loV   = _mm256_set1_epi32(lo - 1);
+        const __m256i hiV   = _mm256_set1_epi32(hi + 1);
+        for (; i + 8 <= n; i += 8) {
+            __m256i h    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&highRem[i]));
+            __m256i lane = _mm256_cmpgt_epi32(h, needV);
+            if (!tall) {
+                __m256i l = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&lowRem[i]));
+                lane = _mm256_or_si256(lane, _mm256_cmpgt_epi32(l, needV));
+            }
+            __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&peopleRem[i]));
+            __m256i k = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&departKey[i]));
+            __m256i ok = _mm256_and_si256(_mm256_cmpgt_epi32(p, occV),
+                         _mm256_and_si256(_mm256_cmpgt_epi32(k, loV),
+                                          _mm256_cmpgt_epi32(hiV, k)));
+            int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_and_si256(lane, ok)));
+            while (mask) {
+                out.push_back(i + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i needV = _mm_set1_epi32(need - 1);
+        const __m128i occV  = _mm_set1_epi32(occ - 1);
+        const __m128i loV   = _mm_set1_epi32(lo - 1);
+        const __m128i hiV   = _mm_set1_epi32(hi + 1);
+        for (; i + 4 <= n; i += 4) {
+            __m128i h    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&highRem[i]));
+            __m128i lane = _mm_cmpgt_epi32(h, needV);
+            if (!tall) {
+                __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&lowRem[i]));
+                lane = _mm_or_si128(lane, _mm_cmpgt_epi32(l, needV));
+            }
+            __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&peopleRem[i]));
+            __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&departKey[i]));
+            __m128i ok = _mm_and_si128(_mm_cmpgt_epi32(p, occV),
+                         _mm_and_si128(_mm_cmpgt_epi32(k, loV),
+                                       _mm_cmplt_epi32(k, hiV)));
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(lane, ok)));
+            while (mask) {
+                out.push_back(i + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__ARM_NEON)
+        const int32x4_t   needV = vdupq_n_s32(need);
+        const int32x4_t   occV  = vdupq_n_s32(occ);
+        const int32x4_t   loV   = vdupq_n_s32(lo);
+        const int32x4_t   hiV   = vdupq_n_s32(hi);
+        for (; i + 4 <= n; i += 4) {
+            uint32x4_t lane = vcgeq_s32(vld1q_s32(&highRem[i]), needV);
+            if (!tall)
+                lane = vorrq_u32(lane, vcgeq_s32(vld1q_s32(&lowRem[i]), needV));
+            int32x4_t k = vld1q_s32(&departKey[i]);
+            uint32x4_t ok = vandq_u32(vcgeq_s32(vld1q_s32(&peopleRem[i]), occV),
+                            vandq_u32(vcgeq_s32(k, loV), vcleq_s32(k, hiV)));
+            ok = vandq_u32(ok, lane);
+            if (vmaxvq_u32(ok) == 0) continue;
+            uint32_t m[4];
+            vst1q_u32(m, ok);
+            for (int j = 0; j < 4; ++j)
+                if (m[j]) out.push_back(i + j);
+        }
+#endif
+        for (; i < n; ++i)
+            if (rowMatches(i, tall, need, occ, lo, hi)) out.push_back(i);
+    }
+}
+
+bool AvailabilityTable::rebuild() {
+    clear();
+    std::vector<Sailing::Record> sailings;
+    std::vector<VesselRecord>    vessels;
+    if (!SailingIO::readAllSailings(sailings) || !VesselIO::readAllVessels(vessels))
+        return false;
+
+    std::unordered_map<std::string, int> capacity;
+    for (const auto& v : vessels) capacity[v.vesselName] = v.maxPassengers;
+
+    resizeAll(sailings.size());
+    for (size_t i = 0; i < sailings.size(); ++i) {
+        auto it = capacity.find(sailings[i].vessel_ID);
+        setRow(i, sailings[i], it == capacity.end() ? 0 : it->second);
+    }
+    return true;
+}
+
+bool AvailabilityTable::restore() {
+    clear();
+    Checkpoint::View view;
+    if (!Checkpoint::isCurrent("sailings.dat") || !Checkpoint::isCurrent("vessels.dat")
+     || !Checkpoint::section(Checkpoint::AVAILABILITY, CHECKPOINT_ROW, view))
+        return false;
+
+    const size_t n = view.rows;
+    resizeAll(n);
+    const char* p = view.data;
+    for (std::vector<int32_t>* column : intColumns) {
+        std::memcpy(column->data(), p, n * sizeof(int32_t));
+        p += n * sizeof(int32_t);
+    }
+    std::memcpy(ids.data(), p, n * Sailing::ID_LEN);
+    return true;
+}
+
+size_t AvailabilityTable::saveCheckpoint(std::vector<char>& out) {
+    const size_t n = highRem.size();
+    size_t at = out.size();
+    out.resize(at + n * CHECKPOINT_ROW);
+    for (const std::vector<int32_t>* column : intColumns) {
+        std::memcpy(out.data() + at, column->data(), n * sizeof(int32_t));
+        at += n * sizeof(int32_t);
+    }
+    std::memcpy(out.data() + at, ids.data(), n * Sailing::ID_LEN);
+    return n;
+}
+
+void AvailabilityTable::clear() {
+    resizeAll(0);
+}
+
+void AvailabilityTable::appendRow(const Sailing::Record& rec, int maxPassengers) {
+    resizeAll(highRem.size() + 1);
+    setRow(highRem.size() - 1, rec, maxPassengers);
+}
+
+void AvailabilityTable::updateRow(size_t slot, const Sailing::Record& rec) {
+    if (slot >= highRem.size()) return;
+    setRow(slot, rec, maxPeople[slot]);
+}
+
+void AvailabilityTable::updateRow(size_t slot, const Sailing::Record& rec, int maxPassengers) {
+    if (slot >= highRem.size()) return;
+    setRow(slot, rec, maxPassengers);
+}
+
+void AvailabilityTable::removeRow(size_t slot) {
+    size_t last = highRem.size() - 1;
+    if (slot > last) return;
+    highRem[slot]   = highRem[last];
+    lowRem[slot]    = lowRem[last];
+    peopleRem[slot] = peopleRem[last];
+    departKey[slot] = departKey[last];
+    maxPeople[slot] = maxPeople[last];
+    ids[slot]       = ids[last];
+    resizeAll(last);
+}
+
+size_t AvailabilityTable::size() {
+    return highRem.size();
+}
+
+std::string_view AvailabilityTable::idAt(size_t row) {
+    // a full-width ID from a damaged file has no terminator
+    return std::string_view(ids[row].data(), strnlen(ids[row].data(), Sailing::ID_LEN));
+}
+
+std::vector<std::string> AvailabilityTable::findSailingsWithRoom(Centimetres height,
+                                                                 Centimetres length,
+                                                                 unsigned int occupants,
+                                                                 int firstDay,
+                                                                 int lastDay)
+{
+    std::vector<size_t> rows;
+    filter(height > Reservation::LOW_LANE_HEIGHT_CM,
+           length + Sailing::VEHICLE_BUF_CM,
+           static_cast<int32_t>(occupants),
+           (firstDay - 1) * 24,
+           lastDay * 24 - 1,
+           rows);
+
+    std::vector<std::string> result;
+    result.reserve(rows.size());
+    for (size_t r : rows) result.emplace_back(idAt(r));
+    return result;
+}
+
+const char* AvailabilityTable::kernelName() {
+#if defined(__AVX2__)
+    return "avx2";
+#elif defined(__SSE2__)
+    return "sse2";
+#elif defined(__ARM_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
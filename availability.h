@@ -0,0 +1,155 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// availability.h
+// Description:
+// In-memory, column-oriented copy of the capacity figures of every
+// sailing: remaining high/low lane length, remaining passenger room and
+// a packed departure key, each in its own contiguous array. Row i always
+// mirrors record i of sailings.dat, so SailingIO keeps it current after
+// every append, in-place update and delete.
+//
+// findSailingsWithRoom() filters all rows with a vectorised kernel
+// (AVX2, SSE2 or NEON, chosen at compile time, with a scalar fallback)
+// so agents can be offered alternatives when a sailing is full.
+//
+// Revision History:
+// Rev. 1 - 2025/08/22 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/31 - Team 12
+// - Restored from the startup checkpoint when it is current
+// Rev. 3 - 2025/09/02 - Team 12
+// - updateRow with a new passenger capacity, for vessel substitution
+// Rev. 4 - 2025/09/02 - Team 12
+// - idAt, for the sailing ID filter
+//*******************************
+
+#ifndef AVAILABILITY_H
+#define AVAILABILITY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "sailing.h"
+
+class AvailabilityTable {
+public:
+    // Bytes per row in the checkpoint: five int32 columns and the ID
+    static const size_t CHECKPOINT_ROW = 5 * sizeof(int32_t) + Sailing::ID_LEN;
+
+    //------
+    // Description:
+    // Rebuilds every column from sailings.dat and vessels.dat.
+    // Returns true if successful.
+    // Precondition:
+    // SailingIO and VesselIO must be open
+    static bool rebuild();
+
+    //------
+    // Description:
+    // Loads every column from the checkpoint instead of rebuilding.
+    // Returns false, leaving the table empty, if the checkpoint has no
+    // current copy (sailings.dat or vessels.dat changed since).
+    // Precondition:
+    // Checkpoint::open() has been called
+    static bool restore();
+
+    //------
+    // Description:
+    // Appends every column to `out` in checkpoint layout and returns the
+    // number of rows.
+    // Precondition:
+    // None
+    static size_t saveCheckpoint(std::vector<char>& out);
+
+    //------
+    // Description:
+    // Drops all rows.
+    // Precondition:
+    // None
+    static void clear();
+
+    //------
+    // Description:
+    // Adds a row for a record just appended to sailings.dat.
+    // Precondition:
+    // `rec` was written as the last record of the file
+    static void appendRow(
+        const Sailing::Record& rec,  // [in] Newly appended sailing
+        int maxPassengers            // [in] Passenger capacity of its vessel
+    );
+
+    //------
+    // Description:
+    // Refreshes the lane and passenger columns of one row.
+    // Precondition:
+    // `rec` was just written at record position `slot`
+    static void updateRow(
+        size_t slot,                 // [in] Record position in sailings.dat
+        const Sailing::Record& rec   // [in] Record as written
+    );
+
+    //------
+    // Description:
+    // As updateRow, for a sailing that now has another vessel.
+    // Precondition:
+    // `rec` was just written at record position `slot`
+    static void updateRow(
+        size_t slot,                 // [in] Record position in sailings.dat
+        const Sailing::Record& rec,  // [in] Record as written
+        int maxPassengers            // [in] Passenger capacity of its new vessel
+    );
+
+    //------
+    // Description:
+    // Mirrors SailingIO::deleteSailing: the last row is moved into `slot`
+    // and the table shrinks by one.
+    // Precondition:
+    // slot < size()
+    static void removeRow(
+        size_t slot  // [in] Record position that was deleted
+    );
+
+    //------
+    // Description:
+    // Returns the number of rows.
+    // Precondition:
+    // None
+    static size_t size();
+
+    //------
+    // Description:
+    // Returns the sailing ID of one row.
+    // Precondition:
+    // row < size()
+    static std::string_view idAt(
+        size_t row  // [in] Record position in sailings.dat
+    );
+
+    //------
+    // Description:
+    // Returns the IDs of all sailings departing on days first..last that
+    // can take a vehicle of the given height and length with `occupants`
+    // people, using the same lane rules as createSpecialReservation
+    // (over 2 m tall: high lane only; otherwise low or high lane).
+    // Precondition:
+    // None
+    static std::vector<std::string> findSailingsWithRoom(
+        Centimetres height,      // [in] Vehicle height in cm
+        Centimetres length,      // [in] Vehicle length in cm
+        unsigned int occupants,  // [in] People travelling with the vehicle
+        int firstDay,            // [in] First departure day (DD)
+        int lastDay              // [in] Last departure day (DD)
+    );
+
+    //------
+    // Description:
+    // Returns the name of the filter kernel compiled in ("avx2", "sse2",
+    // "neon" or "scalar").
+    // Precondition:
+    // None
+    static const char* kernelName();
+};
+
+#endif // AVAILABILITY_H
@@ -0,0 +1,601 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// bench.cpp
+// Description:
+// Benchmark driver for the storage layer. Each public operation of
+// SailingIO, VesselIO, VehicleIO and ReservationIO is timed against data
+// files holding 10^3..10^6 records, followed by end-to-end booking,
+// rebooking, check-in and cancellation mixes driven through the Reservation class.
+// Results are printed and written as CSV so runs can be compared.
+//
+// Usage:
+//   make bench
+//   build/setsail_bench [--sizes 1000,10000,...] [--suites sailing,vessel,...]
+//                       [--budget SECONDS] [--iters N] [--out FILE]
+//
+// All data files are created in a scratch directory (bench_data/).
+//
+// Revision History:
+// Rev. 1 - 2025/08/14 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/01 - Team 12
+// - Hot-set sailing lookups and updates
+// Rev. 3 - 2025/09/02 - Team 12
+// - Rebooking in the scenario suite
+// Rev. 4 - 2025/09/02 - Team 12
+// - Vehicle delete and slot reuse timings dropped with deleteVehicle
+// Rev. 5 - 2025/09/02 - Team 12
+// - Raw reservations built with Reservation::fromFields
+//*******************************
+
+#include "../sailing.h"
+#include "../sailing_io.h"
+#include "../availability.h"
+#include "../vessel.h"
+#include "../vessel_io.h"
+#include "../vehicle.h"
+#include "../vehicle_io.h"
+#include "../reservation.h"
+#include "../reservation_io.h"
+#include "../analytics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//------
+// Description:
+// Builds raw records that bypass the domain checks so large files can be
+// populated by appending only.
+class BenchFixture {
+public:
+    static Reservation makeReservation(std::string_view sailingID,
+                                       std::string_view license,
+                                       bool usedHighLane)
+    {
+        Reservation::Fields f;
+        f.sailingID    = sailingID;
+        f.license      = license;
+        f.fare         = 14.0f;
+        f.occupants    = 2;
+        f.usedHighLane = usedHighLane;
+        return Reservation::fromFields(f);
+    }
+};
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    const char* DATA_DIR = "bench_data";
+
+    struct Result {
+        std::string suite;
+        std::string operation;
+        size_t      records;
+        size_t      iterations;
+        double      meanNs;
+        double      p50Ns;
+        double      p99Ns;
+        double      maxNs;
+    };
+
+    struct Options {
+        std::vector<size_t>      sizes   = {1000, 10000, 100000, 1000000};
+        std::vector<std::string> suites  = {"sailing", "vessel", "vehicle",
+                                            "reservation", "scenario"};
+        double                   budget  = 0.5;    // seconds per operation
+        size_t                   iters   = 1000;   // max iterations per operation
+        std::string              outFile = "bench_results.csv";
+    };
+
+    Options opts;
+    std::vector<Result> results;
+    std::mt19937 rng(276);
+
+    // Swallows everything the domain layer prints while an operation is timed.
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+    };
+    NullBuffer nullBuffer;
+
+    struct QuietOutput {
+        std::streambuf* oldOut;
+        std::streambuf* oldErr;
+        QuietOutput()
+            : oldOut(std::cout.rdbuf(&nullBuffer)), oldErr(std::cerr.rdbuf(&nullBuffer)) {}
+        ~QuietOutput() {
+            std::cout.rdbuf(oldOut);
+            std::cerr.rdbuf(oldErr);
+        }
+    };
+
+    std::string sailingID(size_t i) {
+        char buf[32];
+        std::snprintf(buf, sizeof buf, "S%06zu-%02zu-%02zu", i, i % 28 + 1, i % 24);
+        return buf;
+    }
+
+    std::string vesselName(size_t i) {
+        char buf[32];
+        std::snprintf(buf, sizeof buf, "V%07zu", i);
+        return buf;
+    }
+
+    std::string license(size_t i) {
+        char buf[32];
+        std::snprintf(buf, sizeof buf, "L%07zu", i);
+        return buf;
+    }
+
+    size_t pick(size_t n) {
+        return std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+    }
+
+    //------
+    // Description:
+    // Runs `op` until the iteration cap or the time budget is reached and
+    // records latency percentiles. `op` receives the iteration number.
+    template <typename Op>
+    void measure(const std::string& suite,
+                 const std::string& operation,
+                 size_t records,
+                 Op op)
+    {
+        std::vector<double> samples;
+        samples.reserve(opts.iters);
+        auto start = Clock::now();
+        {
+            QuietOutput quiet;
+            for (size_t i = 0; i < opts.iters; ++i) {
+                auto t0 = Clock::now();
+                op(i);
+                auto t1 = Clock::now();
+                samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count());
+                if (std::chrono::duration<double>(t1 - start).count() > opts.budget) break;
+            }
+        }
+
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (double s : samples) sum += s;
+        Result r;
+        r.suite      = suite;
+        r.operation  = operation;
+        r.records    = records;
+        r.iterations = samples.size();
+        r.meanNs     = sum / samples.size();
+        r.p50Ns      = samples[samples.size() / 2];
+        r.p99Ns      = samples[std::min(samples.size() - 1, samples.size() * 99 / 100)];
+        r.maxNs      = samples.back();
+        results.push_back(r);
+
+        std::cout << std::left
+                  << std::setw(12) << suite
+                  << std::setw(30) << operation
+                  << std::right
+                  << std::setw(10) << records
+                  << std::setw(8)  << r.iterations
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(14) << r.meanNs / 1000.0
+                  << std::setw(14) << r.p50Ns / 1000.0
+                  << std::setw(14) << r.p99Ns / 1000.0
+                  << "\n";
+    }
+
+    //------
+    // Description:
+    // Closes every subsystem, removes all data files and reopens them empty.
+    void freshData() {
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        for (const char* f : {"sailings.dat", "vessels.dat", "vehicles.dat", "reservations.dat"})
+            std::filesystem::remove(f);
+        for (int d = 0; d < ReservationIO::SHARD_COUNT; ++d)
+            std::filesystem::remove(ReservationIO::shardPath(d));
+        Vessel::init();
+        Sailing::init();
+        Reservation::init();
+        Vehicle::init();
+    }
+
+    void addVessels(size_t n, Centimetres high, Centimetres low, int passengers) {
+        for (size_t i = 0; i < n; ++i) {
+            VesselRecord rec{};
+            std::strncpy(rec.vesselName, vesselName(i).c_str(), sizeof rec.vesselName - 1);
+            rec.maxPassengers  = passengers;
+            rec.highLaneCm     = high;
+            rec.lowLaneCm      = low;
+            VesselIO::createVessel(rec);
+        }
+    }
+
+    void addSailings(size_t n, size_t vessels, Centimetres high, Centimetres low) {
+        for (size_t i = 0; i < n; ++i) {
+            Sailing::Record rec(sailingID(i).c_str(), vesselName(i % vessels).c_str(), high, low);
+            SailingIO::createSailing(rec);
+        }
+    }
+
+    void addVehicles(size_t n) {
+        for (size_t i = 0; i < n; ++i)
+            Vehicle::createVehicleForReservation(license(i), "604-555-0000");
+    }
+
+    void addReservations(size_t n, size_t sailings) {
+        for (size_t i = 0; i < n; ++i)
+            ReservationIO::createReservation(
+                BenchFixture::makeReservation(sailingID(i % sailings), license(i), i % 2 == 0));
+    }
+
+    //------
+    // Description:
+    // SailingIO: lookup hit/miss, append, in-place update, delete, reports.
+    void benchSailing(size_t n) {
+        freshData();
+        addVessels(10, 100000, 100000, 1000);
+        addSailings(n, 10, 100000, 100000);
+
+        measure("sailing", "checkSailingExists/hit", n,
+                [&](size_t) { SailingIO::checkSailingExists(sailingID(pick(n))); });
+        measure("sailing", "checkSailingExists/miss", n,
+                [&](size_t) { SailingIO::checkSailingExists("ZZZ-99-99"); });
+        measure("sailing", "checkSailingPeopleCapacity", n,
+                [&](size_t) { SailingIO::checkSailingPeopleCapacity(sailingID(pick(n)), 2); });
+        measure("sailing", "getLowRemLaneLength", n,
+                [&](size_t) { SailingIO::getLowRemLaneLength(sailingID(pick(n)), 700); });
+        measure("sailing", "updateSailingForLow", n,
+                [&](size_t i) {
+                    SailingIO::updateSailingForLow(sailingID(pick(n)), i % 2 ? -700 : 700);
+                });
+        measure("sailing", "updateOccupants", n,
+                [&](size_t i) {
+                    SailingIO::updateOccupants(sailingID(pick(n)),
+                                               i % 2 ? -2 : 2, i % 2 ? -700 : 700);
+                });
+        // the booking-window pattern: a few sailings spread through the
+        // file, hit over and over
+        const size_t hot = std::min<size_t>(n, 64);
+        auto hotID = [&] { return sailingID(pick(hot) * (n / hot)); };
+        measure("sailing", "getLowRemLaneLength/hot", n,
+                [&](size_t) { SailingIO::getLowRemLaneLength(hotID(), 700); });
+        measure("sailing", "updateOccupants/hot", n,
+                [&](size_t i) {
+                    SailingIO::updateOccupants(hotID(),
+                                               i % 2 ? -2 : 2, i % 2 ? -700 : 700);
+                });
+
+        size_t next = n;
+        measure("sailing", "createSailing/append", n,
+                [&](size_t) {
+                    Sailing::Record rec(sailingID(next++).c_str(), vesselName(0).c_str(),
+                                        100000, 100000);
+                    SailingIO::createSailing(rec);
+                });
+        measure("sailing", "deleteSailing", n,
+                [&](size_t) { SailingIO::deleteSailing(sailingID(--next)); });
+        measure("sailing", "readAllSailings", n,
+                [&](size_t) {
+                    std::vector<Sailing::Record> all;
+                    SailingIO::readAllSailings(all);
+                });
+        measure("sailing", "findSailingsWithRoom", n,
+                [&](size_t i) {
+                    int day = static_cast<int>(i % 28) + 1;
+                    Sailing::findSailingsWithRoom(320, 1200, 4, day, day + 1);
+                });
+        measure("sailing", "computeUtilisation", n,
+                [&](size_t) {
+                    Analytics::Report report;
+                    Analytics::computeUtilisation(report);
+                });
+        // the paginated report re-scans per row, so keep it to small files
+        if (n <= 10000) {
+            measure("sailing", "printSailingReport", n,
+                    [&](size_t) {
+                        std::istringstream answers(std::string(n / 5 + 1, 'm'));
+                        std::streambuf* oldIn = std::cin.rdbuf(answers.rdbuf());
+                        SailingIO::printSailingReport();
+                        std::cin.rdbuf(oldIn);
+                    });
+        }
+    }
+
+    //------
+    // Description:
+    // VesselIO: lookup hit/miss, read, append, delete.
+    void benchVessel(size_t n) {
+        freshData();
+        addVessels(n, 100000, 100000, 1000);
+
+        measure("vessel", "checkVesselExists/hit", n,
+                [&](size_t) { VesselIO::checkVesselExists(vesselName(pick(n)).c_str()); });
+        measure("vessel", "checkVesselExists/miss", n,
+                [&](size_t) { VesselIO::checkVesselExists("no such vessel"); });
+        measure("vessel", "readVessel", n,
+                [&](size_t) {
+                    VesselRecord rec;
+                    VesselIO::readVessel(vesselName(pick(n)).c_str(), rec);
+                });
+
+        size_t next = n;
+        measure("vessel", "createVessel/append", n,
+                [&](size_t) {
+                    VesselRecord rec{};
+                    std::strncpy(rec.vesselName, vesselName(next++).c_str(),
+                                 sizeof rec.vesselName - 1);
+                    rec.maxPassengers = 100;
+                    VesselIO::createVessel(rec);
+                });
+        measure("vessel", "deleteVessel", n,
+                [&](size_t) { VesselIO::deleteVessel(vesselName(--next).c_str()); });
+        measure("vessel", "readAllVessels", n,
+                [&](size_t) {
+                    std::vector<VesselRecord> all;
+                    VesselIO::readAllVessels(all);
+                });
+    }
+
+    //------
+    // Description:
+    // VehicleIO: lookup hit/miss, special flag, dimensions, append,
+    // delete and create into the freed slots.
+    void benchVehicle(size_t n) {
+        freshData();
+        addVehicles(n);
+
+        measure("vehicle", "checkVehicleExists/hit", n,
+                [&](size_t) { VehicleIO::checkVehicleExists(license(pick(n))); });
+        measure("vehicle", "checkVehicleExists/miss", n,
+                [&](size_t) { VehicleIO::checkVehicleExists("NO-SUCH"); });
+        measure("vehicle", "checkVehicleIsSpecial", n,
+                [&](size_t) { VehicleIO::checkVehicleIsSpecial(license(pick(n))); });
+        measure("vehicle", "getVehicleDimensions", n,
+                [&](size_t) {
+                    float h, l;
+                    VehicleIO::getVehicleDimensions(license(pick(n)), h, l);
+                });
+
+        size_t next = n;
+        measure("vehicle", "createVehicle/append", n,
+                [&](size_t) { Vehicle::createVehicleForReservation(license(next++), "604-555-0000"); });
+    }
+
+    //------
+    // Description:
+    // ReservationIO: lookup hit/miss, append, in-place update, delete,
+    // create into the freed slots.
+    void benchReservation(size_t n) {
+        size_t sailings = std::max<size_t>(1, n / 100);
+        freshData();
+        addReservations(n, sailings);
+
+        measure("reservation", "findReservation/hit", n,
+                [&](size_t) {
+                    size_t i = pick(n);
+                    Reservation res;
+                    ReservationIO::findReservation(sailingID(i % sailings), license(i), res);
+                });
+        measure("reservation", "findReservation/miss", n,
+                [&](size_t) {
+                    Reservation res;
+                    ReservationIO::findReservation("ZZZ-99-99", "NO-SUCH", res);
+                });
+        measure("reservation", "forEachReservationForLicense", n,
+                [&](size_t) {
+                    size_t count = 0;
+                    ReservationIO::forEachReservationForLicense(license(pick(n)),
+                        [&](const Reservation&) { ++count; return true; });
+                });
+        measure("reservation", "hasReservationsForSailing/hit", n,
+                [&](size_t) { ReservationIO::hasReservationsForSailing(sailingID(pick(sailings))); });
+        measure("reservation", "hasReservationsForSailing/miss", n,
+                [&](size_t) { ReservationIO::hasReservationsForSailing("ZZZ-99-99"); });
+        measure("reservation", "markCheckedIn", n,
+                [&](size_t) {
+                    size_t i = pick(n);
+                    ReservationIO::markCheckedIn(sailingID(i % sailings), license(i));
+                });
+
+        size_t next = n;
+        measure("reservation", "createReservation/append", n,
+                [&](size_t) {
+                    ReservationIO::createReservation(
+                        BenchFixture::makeReservation(sailingID(next % sailings), license(next), false));
+                    ++next;
+                });
+        measure("reservation", "deleteReservation", n,
+                [&](size_t) {
+                    --next;
+                    ReservationIO::deleteReservation(sailingID(next % sailings), license(next));
+                });
+        measure("reservation", "createReservation/reuse", n,
+                [&](size_t) {
+                    ReservationIO::createReservation(
+                        BenchFixture::makeReservation(sailingID(next % sailings), license(next), false));
+                    ++next;
+                });
+        measure("reservation", "readAllReservations", n,
+                [&](size_t) {
+                    std::vector<Reservation> all;
+                    ReservationIO::readAllReservations(all);
+                });
+    }
+
+    //------
+    // Description:
+    // End-to-end mixes through the Reservation class on a populated dataset.
+    void benchScenario(size_t n) {
+        size_t sailings = std::max<size_t>(1, n / 100);
+        freshData();
+        addVessels(10, 10000000, 10000000, 100000);
+        addSailings(sailings, 10, 10000000, 10000000);
+        addVehicles(n);
+        addReservations(n, sailings);
+
+        size_t next = n;
+        std::vector<size_t> booked;
+        measure("scenario", "book", n,
+                [&](size_t) {
+                    Reservation::createReservation(sailingID(next % sailings), license(next), 2, "");
+                    booked.push_back(next++);
+                });
+
+        // move bookings one sailing on, then put them back untimed
+        std::vector<size_t> moved(booked.size(), 0);
+        measure("scenario", "rebook", n,
+                [&](size_t i) {
+                    size_t k  = i % booked.size();
+                    size_t id = booked[k];
+                    Reservation::rebookReservation(license(id),
+                                                   sailingID((id + moved[k]) % sailings),
+                                                   sailingID((id + moved[k] + 1) % sailings));
+                    ++moved[k];
+                });
+        {
+            QuietOutput quiet;
+            for (size_t k = 0; k < booked.size(); ++k) {
+                size_t id = booked[k];
+                if (moved[k] % sailings != 0)
+                    Reservation::rebookReservation(license(id),
+                                                   sailingID((id + moved[k]) % sailings),
+                                                   sailingID(id % sailings));
+            }
+        }
+
+        measure("scenario", "checkIn", n,
+                [&](size_t i) {
+                    size_t id = booked[i % booked.size()];
+                    Reservation::logArrivals(sailingID(id % sailings), license(id));
+                });
+        measure("scenario", "cancel", n,
+                [&](size_t) {
+                    if (booked.empty()) return;
+                    size_t id = booked.back();
+                    booked.pop_back();
+                    Reservation::cancelReservation(sailingID(id % sailings), license(id));
+                });
+
+        // 70% book, 20% check-in, 10% cancel
+        measure("scenario", "mix/70-20-10", n,
+                [&](size_t) {
+                    size_t roll = pick(10);
+                    if (roll < 7 || booked.empty()) {
+                        Reservation::createReservation(sailingID(next % sailings), license(next), 2, "");
+                        booked.push_back(next++);
+                    } else if (roll < 9) {
+                        size_t id = booked[pick(booked.size())];
+                        Reservation::logArrivals(sailingID(id % sailings), license(id));
+                    } else {
+                        size_t at = pick(booked.size());
+                        size_t id = booked[at];
+                        booked[at] = booked.back();
+                        booked.pop_back();
+                        Reservation::cancelReservation(sailingID(id % sailings), license(id));
+                    }
+                });
+    }
+
+    std::vector<std::string> splitList(const std::string& s) {
+        std::vector<std::string> out;
+        std::stringstream ss(s);
+        std::string item;
+        while (std::getline(ss, item, ',')) if (!item.empty()) out.push_back(item);
+        return out;
+    }
+
+    bool parseArgs(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return false;
+            }
+            std::string value = argv[++i];
+            if (arg == "--sizes") {
+                opts.sizes.clear();
+                for (const auto& s : splitList(value)) opts.sizes.push_back(std::stoul(s));
+            } else if (arg == "--suites") {
+                opts.suites = splitList(value);
+            } else if (arg == "--budget") {
+                opts.budget = std::stod(value);
+            } else if (arg == "--iters") {
+                opts.iters = std::max<size_t>(1, std::stoul(value));
+            } else if (arg == "--out") {
+                opts.outFile = value;
+            } else {
+                std::cerr << "Unknown option " << arg << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool writeResults(const std::string& path) {
+        std::ofstream out(path);
+        if (!out) return false;
+        out << "suite,operation,records,iterations,mean_ns,p50_ns,p99_ns,max_ns\n";
+        out << std::fixed << std::setprecision(0);
+        for (const auto& r : results) {
+            out << r.suite << ',' << r.operation << ',' << r.records << ','
+                << r.iterations << ',' << r.meanNs << ',' << r.p50Ns << ','
+                << r.p99Ns << ',' << r.maxNs << '\n';
+        }
+        return out.good();
+    }
+}
+
+//------
+// Description:
+// Runs every selected suite at every selected size and writes the CSV.
+int main(int argc, char** argv) {
+    if (!parseArgs(argc, argv)) return 1;
+
+    std::filesystem::path outPath = std::filesystem::absolute(opts.outFile);
+    std::filesystem::create_directories(DATA_DIR);
+    std::filesystem::current_path(DATA_DIR);
+
+    std::cout << std::left
+              << std::setw(12) << "Suite"
+              << std::setw(30) << "Operation"
+              << std::right
+              << std::setw(10) << "Records"
+              << std::setw(8)  << "Iters"
+              << std::setw(14) << "Mean(us)"
+              << std::setw(14) << "P50(us)"
+              << std::setw(14) << "P99(us)"
+              << "\n" << std::string(102, '=') << "\n";
+
+    for (size_t n : opts.sizes) {
+        for (const auto& suite : opts.suites) {
+            if      (suite == "sailing")     benchSailing(n);
+            else if (suite == "vessel")      benchVessel(n);
+            else if (suite == "vehicle")     benchVehicle(n);
+            else if (suite == "reservation") benchReservation(n);
+            else if (suite == "scenario")    benchScenario(n);
+            else std::cerr << "Unknown suite " << suite << "\n";
+        }
+    }
+
+    Sailing::shutdown();
+    Reservation::shutdown();
+    Vehicle::shutdown();
+    Vessel::shutdown();
+
+    if (!writeResults(outPath.string())) {
+        std::cerr << "Error: Unable to write " << outPath << "\n";
+        return 1;
+    }
+    std::cout << "\nResults written to " << outPath.string() << "\n";
+    return 0;
+}
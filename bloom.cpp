@@ -0,0 +1,101 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// bloom.cpp
+// Description:
+// Implementation of the BloomFilter class (see bloom.h).
+//
+// Revision History:
+// Rev. 1 - 2025/09/01 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - save and restore
+//*******************************
+
+#include "bloom.h"
+#include <algorithm>
+#include <cstring>
+
+// FNV-1a over the key, then a 64-bit finaliser so every bit of the result
+// depends on every byte. The high half picks the block.
+uint64_t BloomFilter::hashOf(std::string_view key) {
+    uint64_t h = 1469598103934665603ull;
+    for (unsigned char c : key) {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+size_t BloomFilter::blockOf(uint64_t h) const {
+    // multiply-shift maps the high 32 bits onto [0, blockCount)
+    return static_cast<size_t>(((h >> 32) * blockCount) >> 32) * WORDS_PER_BLOCK;
+}
+
+// Seven 9-bit positions inside the block, from a remix of the hash so
+// they do not repeat the bits that chose the block
+uint64_t BloomFilter::positionsOf(uint64_t h) {
+    h ^= h >> 31;
+    h *= 0xbf58476d1ce4e5b9ull;
+    return h ^ (h >> 32);
+}
+
+void BloomFilter::reset(size_t expectedKeys) {
+    capacity   = std::max(MIN_KEYS, 2 * expectedKeys);
+    blockCount = (capacity * BITS_PER_KEY + 511) / 512;
+    words.assign(blockCount * WORDS_PER_BLOCK, 0);
+    keys = 0;
+}
+
+void BloomFilter::add(std::string_view key) {
+    if (words.empty()) return;
+    uint64_t h = hashOf(key);
+    uint64_t* block = words.data() + blockOf(h);
+    uint64_t  bits  = positionsOf(h);
+    for (int i = 0; i < BITS_PER_PROBE; ++i) {
+        unsigned bit = static_cast<unsigned>(bits >> (9 * i)) & 511;
+        block[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+    ++keys;
+}
+
+bool BloomFilter::mayContain(std::string_view key) const {
+    if (words.empty()) return true;
+    uint64_t h = hashOf(key);
+    const uint64_t* block = words.data() + blockOf(h);
+    uint64_t        bits  = positionsOf(h);
+    for (int i = 0; i < BITS_PER_PROBE; ++i) {
+        unsigned bit = static_cast<unsigned>(bits >> (9 * i)) & 511;
+        if (!(block[bit >> 6] & (uint64_t(1) << (bit & 63)))) return false;
+    }
+    return true;
+}
+
+size_t BloomFilter::save(std::vector<char>& out) const {
+    const uint64_t head[2] = { keys, capacity };
+    size_t at = out.size();
+    out.resize(at + sizeof head + words.size() * sizeof(uint64_t));
+    std::memcpy(out.data() + at, head, sizeof head);
+    std::memcpy(out.data() + at + sizeof head, words.data(), words.size() * sizeof(uint64_t));
+    return 2 + words.size();
+}
+
+bool BloomFilter::restore(const char* data, size_t rows) {
+    *this = BloomFilter();
+    uint64_t head[2];
+    if (rows < 2) return false;
+    std::memcpy(head, data, sizeof head);
+    const size_t cap    = static_cast<size_t>(head[1]);
+    const size_t blocks = (cap * BITS_PER_KEY + 511) / 512;
+    if ((cap != 0 && cap < MIN_KEYS) || rows - 2 != blocks * WORDS_PER_BLOCK) return false;
+    words.resize(rows - 2);
+    std::memcpy(words.data(), data + sizeof head, words.size() * sizeof(uint64_t));
+    blockCount = blocks;
+    keys       = static_cast<size_t>(head[0]);
+    capacity   = cap;
+    return true;
+}
@@ -0,0 +1,103 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// bloom.h
+// Description:
+// Blocked Bloom filter over text keys, used to answer "no such record"
+// without scanning a data file or probing an index. Each key sets 7 bits
+// inside one 512-bit (cache line) block chosen by its hash, so a probe
+// reads one cache line and costs a single hash of the key. At 16 bits per
+// key about one absent key in a thousand still reaches the scan.
+//
+// A filter cannot forget a key: its owner adds every key it stores and
+// rebuilds the filter from its records after a delete or compaction, or
+// once more keys were added than it was sized for (needsRebuild()). An
+// empty filter, one never sized with reset(), answers "maybe" to every
+// key.
+//
+// save() and restore() copy a filter to and from the checkpoint as it
+// is, so its owner does not rebuild it by scanning at startup.
+//
+// Revision History:
+// Rev. 1 - 2025/09/01 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - save and restore for the checkpoint
+//*******************************
+
+#ifndef BLOOM_H
+#define BLOOM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+class BloomFilter {
+public:
+    static constexpr size_t BITS_PER_KEY = 16;
+    static constexpr size_t MIN_KEYS     = 1024;   // smallest capacity
+
+    // Bytes per row written by save(): one 64-bit word
+    static constexpr size_t CHECKPOINT_ROW = sizeof(uint64_t);
+
+    //------
+    // Description:
+    // Empties the filter and sizes it for twice `expectedKeys` (at least
+    // MIN_KEYS), leaving room to grow before a rebuild is needed.
+    // Precondition:
+    // None
+    void reset(size_t expectedKeys);
+
+    //------
+    // Description:
+    // Adds `key` to the filter.
+    // Precondition:
+    // reset() has been called
+    void add(std::string_view key);
+
+    //------
+    // Description:
+    // Returns false only if `key` was never added since the last reset().
+    // Precondition:
+    // None
+    bool mayContain(std::string_view key) const;
+
+    //------
+    // Description:
+    // Appends the filter to `out` in host layout, as rows of
+    // CHECKPOINT_ROW bytes: key count, capacity, then the bit words.
+    // Returns the number of rows.
+    // Precondition:
+    // None
+    size_t save(std::vector<char>& out) const;
+
+    //------
+    // Description:
+    // Replaces the filter with one written by save(). Returns false,
+    // leaving the filter empty, if the rows do not describe a filter.
+    // Precondition:
+    // None
+    bool restore(
+        const char* data,  // [in] Rows written by save()
+        size_t rows        // [in] Number of rows
+    );
+
+    // More keys were added than the filter was sized for
+    bool   needsRebuild() const { return keys > capacity; }
+    size_t keyCount() const { return keys; }
+
+private:
+    static constexpr size_t WORDS_PER_BLOCK = 8;   // 512 bits
+    static constexpr int    BITS_PER_PROBE  = 7;
+
+    static uint64_t hashOf(std::string_view key);
+    static uint64_t positionsOf(uint64_t h);
+    size_t          blockOf(uint64_t h) const;   // index of its first word
+
+    std::vector<uint64_t> words;
+    size_t                blockCount = 0;
+    size_t                keys = 0;
+    size_t                capacity = 0;
+};
+
+#endif // BLOOM_H
@@ -0,0 +1,284 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// checkpoint.cpp
+// Description:
+// Implementation of the Checkpoint class: writing checkpoint.dat from the
+// owners of each section, and mapping it back at startup (mmap where
+// available, one read otherwise).
+//
+// Revision History:
+// Rev. 1 - 2025/08/31 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Flush before stamping; section checksums
+// Rev. 3 - 2025/09/02 - Team 12
+// - Vessel name filter section
+//*******************************
+
+#include "checkpoint.h"
+#include "availability.h"
+#include "sailing_io.h"
+#include "vessel_io.h"
+#include "vehicle_io.h"
+#include "revenue.h"
+#include "reservation_io.h"
+#include "record_file.h"
+#include "bloom.h"
+#include "keys.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define CHECKPOINT_MMAP 1
+#endif
+
+namespace {
+    const char* const CHECKPOINT_FILE = "checkpoint.dat";
+    const char* const TEMP_FILE       = "checkpoint.tmp";
+    const uint64_t    MISSING         = ~uint64_t(0);
+    const uint64_t    ALIGN           = 64;
+
+    // Bumped whenever the row layout of any section changes; checkpoint.dat
+    // keeps it in header.meta[2]
+    const uint32_t    LAYOUT_VERSION  = 1;
+
+    const RecordFile::Format FORMAT = RecordFile::formatOf<CheckpointSection>();
+
+    // The mapped file
+    const char*                    base = nullptr;
+    size_t                         length = 0;
+#if !defined(CHECKPOINT_MMAP)
+    std::vector<char>              buffer;
+#endif
+    std::vector<CheckpointSection> sections;
+    std::vector<std::string>       currentFiles;   // stamps still matching
+
+    // Every file a section is built from
+    std::vector<std::string> sourceFiles() {
+        std::vector<std::string> files = { "vessels.dat", "sailings.dat", "vehicles.dat" };
+        for (int shard = 0; shard < ReservationIO::SHARD_COUNT; ++shard)
+            files.push_back(ReservationIO::shardPath(shard));
+        return files;
+    }
+
+    SourceStamp stampOf(const std::string& path) {
+        SourceStamp stamp;
+        std::memset(&stamp, 0, sizeof stamp);
+        std::memcpy(stamp.path, path.data(), std::min(path.size(), sizeof stamp.path - 1));
+        std::error_code ec;
+        auto size  = std::filesystem::file_size(path, ec);
+        auto mtime = ec ? std::filesystem::file_time_type()
+                        : std::filesystem::last_write_time(path, ec);
+        stamp.size  = ec ? MISSING : static_cast<uint64_t>(size);
+        stamp.mtime = ec ? 0 : static_cast<uint64_t>(mtime.time_since_epoch().count());
+        return stamp;
+    }
+
+    void unmap() {
+#if defined(CHECKPOINT_MMAP)
+        if (base) munmap(const_cast<char*>(base), length);
+#else
+        buffer.clear();
+        buffer.shrink_to_fit();
+#endif
+        base   = nullptr;
+        length = 0;
+        sections.clear();
+        currentFiles.clear();
+    }
+
+    bool mapFile() {
+#if defined(CHECKPOINT_MMAP)
+        int fd = ::open(CHECKPOINT_FILE, O_RDONLY);
+        if (fd < 0) return false;
+        off_t size = lseek(fd, 0, SEEK_END);
+        void* p = size > 0 ? mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, fd, 0)
+                           : MAP_FAILED;
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        base   = static_cast<const char*>(p);
+        length = static_cast<size_t>(size);
+#else
+        std::ifstream in(CHECKPOINT_FILE, std::ios::binary | std::ios::ate);
+        if (!in) return false;
+        buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        if (!in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) return false;
+        base   = buffer.data();
+        length = buffer.size();
+#endif
+        return true;
+    }
+
+    bool refuse(const std::string& why) {
+        std::cerr << "Warning: " << CHECKPOINT_FILE << ": " << why
+                  << "; rebuilding from the data files\n";
+        unmap();
+        return false;
+    }
+
+    // Pads `out` with zeros to the next ALIGN boundary past `start`
+    void align(std::vector<char>& out, uint64_t start) {
+        while ((start + out.size()) % ALIGN) out.push_back(0);
+    }
+}
+
+bool Checkpoint::open() {
+    unmap();
+    if (!schema::HOST_LITTLE_ENDIAN || !std::filesystem::exists(CHECKPOINT_FILE)) return false;
+    if (!mapFile()) return refuse("cannot map");
+
+    const size_t headerSize = RecordFile::HEADER_SIZE;
+    FileHeader header;
+    if (length < headerSize) return refuse("truncated");
+    schema::decode(base, header);
+    std::string problem = RecordFile::validate(header, FORMAT, -1);
+    if (!problem.empty()) return refuse(problem);
+    if (header.meta[2] != LAYOUT_VERSION) return refuse("written by another version");
+
+    const size_t dirSize   = size_t(header.liveCount) * RecordSchema<CheckpointSection>::SIZE;
+    const size_t stampSize = size_t(header.meta[0]) * RecordSchema<SourceStamp>::SIZE;
+    if (length < headerSize + dirSize + stampSize) return refuse("truncated");
+    if (RecordFile::crc32(base + headerSize, dirSize + stampSize) != header.meta[1])
+        return refuse("directory checksum mismatch");
+
+    const char* p = base + headerSize;
+    for (uint32_t i = 0; i < header.liveCount; ++i, p += RecordSchema<CheckpointSection>::SIZE) {
+        CheckpointSection s;
+        schema::decode(p, s);
+        if (s.offset % ALIGN || s.offset > length || s.bytes > length - s.offset
+         || s.bytes != s.rowCount * s.rowSize)
+            return refuse("section " + std::to_string(s.kind) + " out of bounds");
+        sections.push_back(s);
+    }
+    for (uint32_t i = 0; i < header.meta[0]; ++i, p += RecordSchema<SourceStamp>::SIZE) {
+        SourceStamp then;
+        schema::decode(p, then);
+        std::string path(fieldView(then.path));
+        SourceStamp now = stampOf(path);
+        if (now.size == then.size && now.mtime == then.mtime) currentFiles.push_back(path);
+    }
+    return true;
+}
+
+bool Checkpoint::isCurrent(std::string_view path) {
+    for (const std::string& f : currentFiles)
+        if (f == path) return true;
+    return false;
+}
+
+bool Checkpoint::section(Section kind, size_t rowSize, View& out) {
+    for (const CheckpointSection& s : sections) {
+        if (s.kind != kind) continue;
+        if (s.rowSize != rowSize) return false;
+        if (RecordFile::crc32(base + s.offset, static_cast<size_t>(s.bytes)) != s.checksum) {
+            std::cerr << "Warning: " << CHECKPOINT_FILE << ": section " << s.kind
+                      << " checksum mismatch; rebuilding it from the data files\n";
+            return false;
+        }
+        out.data    = base + s.offset;
+        out.rows    = static_cast<size_t>(s.rowCount);
+        out.rowSize = rowSize;
+        return true;
+    }
+    return false;
+}
+
+bool Checkpoint::write() {
+    // 0) Nothing may stay buffered: the stamps below must describe the
+    //    files as closing them will leave them
+    if (!SailingIO::flush() || !VesselIO::flush()
+     || !VehicleIO::flush() || !ReservationIO::flush()) {
+        std::cerr << "Error: cannot flush the data files; checkpoint not written\n";
+        return false;
+    }
+
+    // 1) Section payloads from their owners
+    struct Payload {
+        Section           kind;
+        size_t            rowSize;
+        size_t            rows;
+        std::vector<char> bytes;
+    };
+    Payload payloads[] = {
+        { AVAILABILITY, AvailabilityTable::CHECKPOINT_ROW, 0, {} },
+        { LICENSE_KEYS, VehicleIO::CHECKPOINT_ROW,         0, {} },
+        { REVENUE,      RevenueLedger::CHECKPOINT_ROW,     0, {} },
+        { VESSEL_NAMES, BloomFilter::CHECKPOINT_ROW,       0, {} },
+    };
+    payloads[0].rows = AvailabilityTable::saveCheckpoint(payloads[0].bytes);
+    payloads[1].rows = VehicleIO::saveCheckpoint(payloads[1].bytes);
+    payloads[2].rows = RevenueLedger::saveCheckpoint(payloads[2].bytes);
+    payloads[3].rows = VesselIO::saveCheckpoint(payloads[3].bytes);
+
+    // 2) Directory and stamps, then the sections on ALIGN boundaries
+    std::vector<std::string> files = sourceFiles();
+    const size_t count = sizeof payloads / sizeof payloads[0];
+    const uint64_t dirSize = count * RecordSchema<CheckpointSection>::SIZE
+                           + files.size() * RecordSchema<SourceStamp>::SIZE;
+    std::vector<char> dir(dirSize);
+    char* p = dir.data();
+    uint64_t offset = RecordFile::HEADER_SIZE + dirSize;
+    offset += (ALIGN - offset % ALIGN) % ALIGN;
+    for (const Payload& pl : payloads) {
+        CheckpointSection s{ pl.kind, static_cast<uint32_t>(pl.rowSize), pl.rows,
+                             offset, pl.bytes.size(),
+                             RecordFile::crc32(pl.bytes.data(), pl.bytes.size()), 0 };
+        schema::encode(s, p);
+        p += RecordSchema<CheckpointSection>::SIZE;
+        offset += pl.bytes.size();
+        offset += (ALIGN - offset % ALIGN) % ALIGN;
+    }
+    for (const std::string& f : files) {
+        schema::encode(stampOf(f), p);
+        p += RecordSchema<SourceStamp>::SIZE;
+    }
+
+    FileHeader header = RecordFile::freshHeader(FORMAT);
+    header.liveCount = static_cast<uint32_t>(count);
+    header.meta[0]   = static_cast<uint32_t>(files.size());
+    header.meta[1]   = RecordFile::crc32(dir.data(), dir.size());
+    header.meta[2]   = LAYOUT_VERSION;
+
+    std::ofstream out(TEMP_FILE, std::ios::binary | std::ios::trunc);
+    RecordFile::writeHeader(out, header);
+    out.write(dir.data(), static_cast<std::streamsize>(dir.size()));
+    uint64_t written = RecordFile::HEADER_SIZE + dirSize;
+    std::vector<char> pad;
+    for (const Payload& pl : payloads) {
+        pad.clear();
+        align(pad, written);
+        out.write(pad.data(), static_cast<std::streamsize>(pad.size()));
+        out.write(pl.bytes.data(), static_cast<std::streamsize>(pl.bytes.size()));
+        written += pad.size() + pl.bytes.size();
+    }
+    out.close();
+    STATS_WRITE(written);
+
+    // 3) Replace the old checkpoint in one step
+    std::error_code ec;
+    if (out.fail()) {
+        std::filesystem::remove(TEMP_FILE, ec);
+        std::cerr << "Error: cannot write " << TEMP_FILE << "\n";
+        return false;
+    }
+    std::filesystem::rename(TEMP_FILE, CHECKPOINT_FILE, ec);
+    if (ec) {
+        std::cerr << "Error: cannot replace " << CHECKPOINT_FILE << ": " << ec.message() << "\n";
+        return false;
+    }
+    return true;
+}
+
+void Checkpoint::close() {
+    unmap();
+}
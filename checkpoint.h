@@ -0,0 +1,156 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// checkpoint.h
+// Description:
+// Startup snapshot of the in-memory state that is otherwise rebuilt by
+// scanning the data files on every launch: the availability columns
+// (sailings.dat + vessels.dat), the license key column (vehicles.dat),
+// the revenue ledger (the reservation shards) and the vessel name filter
+// (vessels.dat). The sailing ID filter is filled from the availability
+// columns.
+//
+// checkpoint.dat is written at shutdown, or on demand from the
+// statistics menu, to checkpoint.tmp and renamed into place. It holds a
+// RecordFile header (live count = sections), a directory of sections, a
+// stamp (size and modification time) of every source file, then each
+// section's rows in host layout on a 64-byte boundary, so open() maps the
+// file and the owners copy their rows out with one memcpy per column.
+// Every data file is flushed before it is stamped, so the stamps match
+// what closing the files leaves on disk. Each section carries a CRC-32
+// of its rows, checked when its owner asks for it.
+//
+// There is no separate log: each data file is its own. A section is only
+// used if the files it was built from still carry the stamps recorded
+// with it; otherwise its owner rebuilds it by scanning, as before. The
+// ledger is split by shard, so only shards written since the checkpoint
+// are rescanned. A write that lands within the same clock tick as the
+// checkpoint and leaves the size unchanged is not detected; on the
+// nanosecond clocks of current file systems that needs a restart within
+// the tick the checkpoint was written in.
+//
+// Sections are only mapped on little-endian hosts; elsewhere every
+// owner rebuilds.
+//
+// Revision History:
+// Rev. 1 - 2025/08/31 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Data files flushed before they are stamped; CRC per section
+// Rev. 3 - 2025/09/02 - Team 12
+// - Vessel name filter section
+//*******************************
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "schema.h"
+
+// Directory entry of one section in checkpoint.dat
+struct CheckpointSection {
+    uint32_t kind;       // Checkpoint::Section
+    uint32_t rowSize;    // bytes per row
+    uint64_t rowCount;   // rows in the section
+    uint64_t offset;     // file offset of the first row
+    uint64_t bytes;      // bytes in the section
+    uint32_t checksum;   // CRC-32 of the section's bytes
+    uint32_t reserved;   // zero
+};
+
+template <>
+struct RecordSchema<CheckpointSection> {
+    static constexpr const char*   NAME    = "checkpoint-section";
+    static constexpr uint32_t      VERSION = 2;
+    static constexpr uint32_t      SIZE    = 40;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(CheckpointSection, kind,     schema::Type::UInt32,  0, 4),
+        SCHEMA_FIELD(CheckpointSection, rowSize,  schema::Type::UInt32,  4, 4),
+        SCHEMA_FIELD(CheckpointSection, rowCount, schema::Type::UInt64,  8, 8),
+        SCHEMA_FIELD(CheckpointSection, offset,   schema::Type::UInt64, 16, 8),
+        SCHEMA_FIELD(CheckpointSection, bytes,    schema::Type::UInt64, 24, 8),
+        SCHEMA_FIELD(CheckpointSection, checksum, schema::Type::UInt32, 32, 4),
+        SCHEMA_FIELD(CheckpointSection, reserved, schema::Type::UInt32, 36, 4),
+    };
+};
+static_assert(schema::layoutMatches<CheckpointSection>(), "CheckpointSection does not match checkpoint.dat");
+
+// Size and modification time of one source file when the checkpoint was written
+struct SourceStamp {
+    char     path[32];   // file name in the data directory
+    uint64_t size;       // bytes, all ones if there was no file
+    uint64_t mtime;      // file clock ticks
+};
+
+template <>
+struct RecordSchema<SourceStamp> {
+    static constexpr const char*   NAME    = "source-stamp";
+    static constexpr uint32_t      VERSION = 1;
+    static constexpr uint32_t      SIZE    = 48;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(SourceStamp, path,  schema::Type::Text,    0, 32),
+        SCHEMA_FIELD(SourceStamp, size,  schema::Type::UInt64, 32, 8),
+        SCHEMA_FIELD(SourceStamp, mtime, schema::Type::UInt64, 40, 8),
+    };
+};
+static_assert(schema::layoutMatches<SourceStamp>(), "SourceStamp does not match checkpoint.dat");
+
+class Checkpoint {
+public:
+    enum Section : uint32_t { AVAILABILITY = 1, LICENSE_KEYS = 2, REVENUE = 3, VESSEL_NAMES = 4 };
+
+    // Rows of one mapped section
+    struct View {
+        const char* data    = nullptr;
+        size_t      rows    = 0;
+        size_t      rowSize = 0;
+    };
+
+    //------
+    // Description:
+    // Maps checkpoint.dat if there is a valid one and compares its stamps
+    // with the data files as they are now. Returns false (and every
+    // section is unavailable) if there is none.
+    // Precondition:
+    // Called before any subsystem opens its data files
+    static bool open();
+
+    //------
+    // Description:
+    // Returns true if `path` is unchanged since the checkpoint was
+    // written, including a file that was missing then and still is.
+    // Precondition:
+    // None
+    static bool isCurrent(std::string_view path);
+
+    //------
+    // Description:
+    // Points `out` at the rows of section `kind` if it was mapped with
+    // rows of `rowSize` bytes and they match their checksum. The rows
+    // stay valid until close().
+    // Precondition:
+    // None
+    static bool section(
+        Section kind,    // [in] Section wanted
+        size_t rowSize,  // [in] Row size the caller reads
+        View& out        // [out] Mapped rows
+    );
+
+    //------
+    // Description:
+    // Flushes every data file, then writes checkpoint.dat from the
+    // current in-memory state. Returns true if successful.
+    // Precondition:
+    // Every subsystem initialised
+    static bool write();
+
+    //------
+    // Description:
+    // Unmaps checkpoint.dat.
+    // Precondition:
+    // None
+    static void close();
+};
+
+#endif // CHECKPOINT_H
@@ -0,0 +1,104 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// keys.h
+// Description:
+// Fixed-capacity key types used instead of std::string for sailing IDs,
+// vehicle licenses, vessel names and phone numbers. A key is a NUL-padded
+// char array: it never allocates, is trivially copyable (so it can sit
+// inside an on-disk record) and compares with a single memcmp.
+//
+// Text longer than a key's capacity is truncated when a key is built, but
+// comparisons against a std::string_view use the full view, so an
+// over-long probe never matches a stored key.
+//
+// Revision History:
+// Rev. 1 - 2025/08/24 - Team 12
+// - Initial implementation
+//*******************************
+
+#ifndef KEYS_H
+#define KEYS_H
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <string_view>
+
+//------
+// Description:
+// Returns the text held in a fixed-width, NUL-padded record field.
+// Precondition:
+// None
+template <size_t N>
+inline std::string_view fieldView(const char (&field)[N]) {
+    return std::string_view(field, strnlen(field, N));
+}
+
+template <size_t N>
+class FixedKey {
+public:
+    static constexpr size_t CAPACITY = N - 1;  // longest text kept; always NUL-terminated
+
+    FixedKey() { std::memset(bytes, 0, N); }
+    FixedKey(std::string_view text) { assign(text); }
+    template <size_t M>
+    FixedKey(const char (&field)[M]) { assign(fieldView(field)); }
+
+    FixedKey& operator=(std::string_view text) {
+        assign(text);
+        return *this;
+    }
+    template <size_t M>
+    FixedKey& operator=(const char (&field)[M]) {
+        assign(fieldView(field));
+        return *this;
+    }
+
+    std::string_view view() const { return std::string_view(bytes, strnlen(bytes, N)); }
+    const char* c_str() const { return bytes; }
+    const char* data() const { return bytes; }
+    bool empty() const { return bytes[0] == '\0'; }
+
+    friend bool operator==(const FixedKey& a, const FixedKey& b) {
+        return std::memcmp(a.bytes, b.bytes, N) == 0;
+    }
+    friend bool operator!=(const FixedKey& a, const FixedKey& b) { return !(a == b); }
+
+    friend bool operator==(const FixedKey& a, std::string_view b) { return a.view() == b; }
+    friend bool operator==(std::string_view a, const FixedKey& b) { return b.view() == a; }
+    friend bool operator!=(const FixedKey& a, std::string_view b) { return !(a == b); }
+    friend bool operator!=(std::string_view a, const FixedKey& b) { return !(b == a); }
+
+    template <size_t M>
+    friend bool operator==(const FixedKey& a, const char (&field)[M]) {
+        return a.view() == fieldView(field);
+    }
+    template <size_t M>
+    friend bool operator!=(const FixedKey& a, const char (&field)[M]) { return !(a == field); }
+
+private:
+    void assign(std::string_view text) {
+        size_t len = text.size() < CAPACITY ? text.size() : CAPACITY;
+        std::memset(bytes, 0, N);
+        std::memcpy(bytes, text.data(), len);
+    }
+
+    char bytes[N];
+};
+
+// Sized to the widest record field each key is stored in or compared with
+using SailingKey  = FixedKey<32>;  // Sailing::Record::sailingID
+using LicenseKey  = FixedKey<32>;  // VehicleRecord::license, padded for vector compares
+using VesselName  = FixedKey<30>;  // VesselRecord::vesselName
+using PhoneNumber = FixedKey<15>;  // VehicleRecord::phone
+
+namespace std {
+    template <size_t N>
+    struct hash<FixedKey<N>> {
+        size_t operator()(const FixedKey<N>& key) const noexcept {
+            return hash<string_view>()(key.view());
+        }
+    };
+}
+
+#endif // KEYS_H
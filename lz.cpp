@@ -0,0 +1,123 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// lz.cpp
+// Description:
+// Implementation of the archive block compressor (see lz.h).
+//
+// Revision History:
+// Rev. 1 - 2025/08/30 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - decompress rejects a block whose final literals-only sequence is missing
+//*******************************
+
+#include "lz.h"
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    const size_t MIN_MATCH  = 4;
+    const size_t MAX_OFFSET = 65535;
+    const int    HASH_BITS  = 12;
+
+    uint32_t read32(const char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof v);
+        return v;
+    }
+
+    uint32_t hashOf(uint32_t v) {
+        return (v * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    // Writes the part of a length that does not fit in its nibble
+    void putLength(std::vector<char>& out, size_t rest) {
+        while (rest >= 255) {
+            out.push_back(static_cast<char>(255));
+            rest -= 255;
+        }
+        out.push_back(static_cast<char>(rest));
+    }
+
+    void putSequence(std::vector<char>& out, const char* literals, size_t litLen,
+                     size_t offset, size_t matchLen)
+    {
+        size_t matchCode = matchLen ? matchLen - MIN_MATCH : 0;
+        out.push_back(static_cast<char>(((litLen < 15 ? litLen : 15) << 4)
+                                        | (matchCode < 15 ? matchCode : 15)));
+        if (litLen >= 15) putLength(out, litLen - 15);
+        out.insert(out.end(), literals, literals + litLen);
+        if (matchLen == 0) return;      // last sequence: literals only
+        out.push_back(static_cast<char>(offset & 0xFF));
+        out.push_back(static_cast<char>(offset >> 8));
+        if (matchCode >= 15) putLength(out, matchCode - 15);
+    }
+
+    // Reads the rest of a length whose nibble was 15; false if truncated
+    bool getLength(const unsigned char*& in, const unsigned char* end, size_t& len) {
+        unsigned char b;
+        do {
+            if (in == end) return false;
+            b = *in++;
+            len += b;
+        } while (b == 255);
+        return true;
+    }
+}
+
+namespace lz {
+
+void compress(const char* src, size_t n, std::vector<char>& out) {
+    int32_t table[1 << HASH_BITS];
+    for (int32_t& t : table) t = -1;
+
+    size_t anchor = 0;   // first byte not yet emitted
+    size_t i      = 0;
+    while (i + MIN_MATCH <= n) {
+        uint32_t word = read32(src + i);
+        uint32_t h    = hashOf(word);
+        int32_t  cand = table[h];
+        table[h] = static_cast<int32_t>(i);
+        if (cand >= 0 && i - static_cast<size_t>(cand) <= MAX_OFFSET
+         && read32(src + cand) == word) {
+            size_t len = MIN_MATCH;
+            while (i + len < n && src[cand + len] == src[i + len]) ++len;
+            putSequence(out, src + anchor, i - anchor, i - static_cast<size_t>(cand), len);
+            i += len;
+            anchor = i;
+        } else {
+            ++i;
+        }
+    }
+    putSequence(out, src + anchor, n - anchor, 0, 0);
+}
+
+bool decompress(const char* src, size_t n, char* dst, size_t rawSize) {
+    const unsigned char* in  = reinterpret_cast<const unsigned char*>(src);
+    const unsigned char* end = in + n;
+    size_t out = 0;
+
+    while (in < end) {
+        unsigned char token = *in++;
+        size_t litLen = token >> 4;
+        if (litLen == 15 && !getLength(in, end, litLen)) return false;
+        if (litLen > static_cast<size_t>(end - in) || litLen > rawSize - out) return false;
+        std::memcpy(dst + out, in, litLen);
+        in  += litLen;
+        out += litLen;
+        if (in == end) return out == rawSize;   // last sequence
+
+        if (end - in < 2) return false;
+        size_t offset = in[0] | (size_t(in[1]) << 8);
+        in += 2;
+        size_t matchLen = token & 0x0F;
+        if (matchLen == 15 && !getLength(in, end, matchLen)) return false;
+        matchLen += MIN_MATCH;
+        if (offset == 0 || offset > out || matchLen > rawSize - out) return false;
+        // byte by byte: a match may overlap the bytes it is producing
+        for (size_t k = 0; k < matchLen; ++k, ++out) dst[out] = dst[out - offset];
+    }
+    return false;                       // cut off before the last sequence
+}
+
+} // namespace lz
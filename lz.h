@@ -0,0 +1,48 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// lz.h
+// Description:
+// Small LZ77 block compressor for the cold archive. A block is encoded as
+// a run of sequences, each a token byte (literal count in the high
+// nibble, match length - 4 in the low nibble, 15 meaning "more bytes
+// follow, 255 at a time"), the literals, and a 2-byte little-endian
+// back-reference offset. The last sequence has literals only. Matches are
+// found through a 4096-entry hash of 4-byte prefixes, so compression is a
+// single greedy pass; fixed-width records with NUL-padded text and
+// repeated IDs typically shrink to a fraction of their size.
+//
+// Revision History:
+// Rev. 1 - 2025/08/30 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - A block cut short before its last sequence is rejected
+//*******************************
+
+#ifndef LZ_H
+#define LZ_H
+
+#include <cstddef>
+#include <vector>
+
+namespace lz {
+
+//------
+// Description:
+// Appends the compressed form of `n` bytes at `src` to `out`.
+// Precondition:
+// None
+void compress(const char* src, size_t n, std::vector<char>& out);
+
+//------
+// Description:
+// Expands `n` compressed bytes at `src` into exactly `rawSize` bytes at
+// `dst`. Returns false if the input is malformed, ends before its
+// literals-only last sequence, or does not expand to exactly rawSize
+// bytes.
+// Precondition:
+// `dst` has room for rawSize bytes
+bool decompress(const char* src, size_t n, char* dst, size_t rawSize);
+
+} // namespace lz
+
+#endif // LZ_H
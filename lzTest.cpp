@@ -0,0 +1,120 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// lzTest.cpp
+// Description:
+// Unit test driver for the archive's LZ77 block codec. Checks that
+// compress/decompress round-trip the inputs that exercise each part of
+// the sequence format, and that damaged input is rejected rather than
+// expanded.
+//
+// Test Case:
+// 1. Empty input round-trips
+// 2. A long run of incompressible bytes (extended literal count)
+// 3. Runs of one byte and of a short pattern (overlapping matches,
+//    extended match length)
+// 4. Encoded reservation records, which must also shrink
+// 5. Every truncation of a compressed block is rejected
+// 6. A wrong raw size and an offset before the start are rejected
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+//*******************************
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "lz.h"
+#include "reservation_io.h"
+
+namespace {
+    // Compresses `raw`, expands it again and compares
+    bool roundTrips(const std::string& name, const std::string& raw,
+                    std::vector<char>& packed) {
+        packed.clear();
+        lz::compress(raw.data(), raw.size(), packed);
+        std::string back(raw.size(), '\0');
+        if (!lz::decompress(packed.data(), packed.size(), &back[0], back.size())
+         || back != raw) {
+            std::cerr << name << ": does not round-trip\n";
+            return false;
+        }
+        return true;
+    }
+}
+
+//------
+// Description:
+// Main test driver function
+int lzTest() {
+    std::cout << "Starting LZ codec test...\n";
+    std::vector<char> packed;
+
+    // Test 1: Empty input
+    if (!roundTrips("empty input", std::string(), packed)) return 1;
+
+    // Test 2: Incompressible bytes, far more than one token's 15 literals
+    std::mt19937 rng(276);
+    std::string noise(5000, '\0');
+    for (char& c : noise) c = static_cast<char>(rng());
+    if (!roundTrips("literal run", noise, packed)) return 1;
+
+    // Test 3: Matches that overlap the bytes they produce
+    if (!roundTrips("one-byte run", std::string(4000, 'A'), packed)) return 1;
+    if (packed.size() > 40) {
+        std::cerr << "one-byte run: " << packed.size() << " bytes packed\n";
+        return 1;
+    }
+    std::string pattern;
+    for (int i = 0; i < 1000; ++i) pattern += "abc";
+    if (!roundTrips("short pattern", noise.substr(0, 7) + pattern + noise.substr(7, 9), packed))
+        return 1;
+
+    // Test 4: Encoded records with NUL-padded keys
+    const size_t recSize = RecordSchema<Reservation>::SIZE;
+    std::string records(200 * recSize, '\0');
+    for (size_t i = 0; i < 200; ++i) {
+        Reservation::Fields f;
+        std::string license = "LIC" + std::to_string(i);
+        f.sailingID = "AAA-01-08";
+        f.license   = license;
+        f.fare      = 14.0f;
+        f.occupants = 1 + i % 4;
+        schema::encode(Reservation::fromFields(f), &records[i * recSize]);
+    }
+    if (!roundTrips("records", records, packed)) return 1;
+    if (packed.size() * 2 > records.size()) {
+        std::cerr << "records: " << packed.size() << " of " << records.size()
+                  << " bytes packed\n";
+        return 1;
+    }
+
+    // Test 5: Every truncation fails instead of expanding short
+    std::vector<char> raw(records.size());
+    for (size_t n = 0; n < packed.size(); ++n) {
+        if (lz::decompress(packed.data(), n, raw.data(), raw.size())) {
+            std::cerr << "block cut to " << n << " bytes was accepted\n";
+            return 1;
+        }
+    }
+
+    // Test 6: Wrong raw size, and a match reaching before the output
+    if (lz::decompress(packed.data(), packed.size(), raw.data(), raw.size() - 1)) {
+        std::cerr << "short raw size was accepted\n";
+        return 1;
+    }
+    raw.push_back('\0');
+    if (lz::decompress(packed.data(), packed.size(), raw.data(), raw.size())) {
+        std::cerr << "long raw size was accepted\n";
+        return 1;
+    }
+    const char badOffset[] = { 0x10, 'x', 0x05, 0x00 };   // 1 literal, offset 5
+    if (lz::decompress(badOffset, sizeof badOffset, raw.data(), 5)) {
+        std::cerr << "offset before the start was accepted\n";
+        return 1;
+    }
+
+    std::cout << "LZ codec test: Pass\n";
+    return 0;
+}
@@ -8,6 +8,8 @@
 // Revision History:
 // Rev. 1 - 2025/07/07 - Team 12
 // - Created initial version
+// Rev. 2 - 2025/09/02 - Team 12
+// - Exits non-zero if startup fails
 //*******************************
 
 #include <iostream>
@@ -21,7 +23,7 @@
 // Description:
 // Main calls UI and handles startup and shutdown functions
 int main() {
-  UserInterface::startup();
+  if (!UserInterface::startup()) return 1;
   UserInterface::interface(); 
   UserInterface::shutdown();
   return 0;
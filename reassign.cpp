@@ -0,0 +1,443 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// reassign.cpp
+// Description:
+// Implementation of the Reassignment class (see reassign.h).
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - substituteVessel; lane choice shared with cancelSailing
+// Rev. 3 - 2025/09/02 - Team 12
+// - makeLaneRoom
+// Rev. 4 - 2025/09/02 - Team 12
+// - cancelSailing keeps the ledger in step when the delete fails
+// Rev. 5 - 2025/09/02 - Team 12
+// - undoLaneRoom, for bookings that fail after room was made
+//*******************************
+
+#include "reassign.h"
+#include "reservation_io.h"
+#include "revenue.h"
+#include "sailing.h"
+#include "sailing_io.h"
+#include "stats.h"
+#include "trace.h"
+#include "vehicle_io.h"
+#include "vessel_io.h"
+#include <algorithm>
+#include <iomanip>
+#include <map>
+
+bool Reassignment::loadRoom(std::string_view sailingID, Room& out) {
+    Sailing::Record rec;
+    VesselRecord    vessel;
+    if (!SailingIO::readSailing(sailingID, rec)
+     || !VesselIO::readVessel(fieldView(rec.vessel_ID), vessel))
+        return false;
+    out        = Room();
+    out.id     = std::string(sailingID);
+    out.high   = rec.HRL_cm;
+    out.low    = rec.LRL_cm;
+    out.people = long(vessel.maxPassengers) - rec.ppl_on_board;
+    return true;
+}
+
+Centimetres Reassignment::lengthOf(const Reservation& res) {
+    return res.specialVehicleLengthCm > 0 ? res.specialVehicleLengthCm
+                                          : Reservation::REGULAR_LENGTH_CM;
+}
+
+bool Reassignment::isTall(const Reservation& res) {
+    return res.specialVehicleHeightCm > Reservation::LOW_LANE_HEIGHT_CM;
+}
+
+void Reassignment::sortForPacking(std::vector<Reservation>& vehicles) {
+    std::stable_sort(vehicles.begin(), vehicles.end(),
+                     [](const Reservation& a, const Reservation& b) {
+                         if (isTall(a) != isTall(b)) return isTall(a);
+                         return lengthOf(a) > lengthOf(b);
+                     });
+}
+
+bool Reassignment::chooseLane(const Room& room, const Reservation& res,
+                              bool preferHigh, bool& high) {
+    const Centimetres need = lengthOf(res) + Sailing::VEHICLE_BUF_CM;
+    const bool lowFits  = !isTall(res) && room.low >= need;
+    const bool highFits = room.high >= need;
+    if (lowFits && !(preferHigh && highFits)) high = false;
+    else if (highFits)                        high = true;
+    else                                      return false;
+    return true;
+}
+
+void Reassignment::take(Room& room, const Reservation& res, bool high) {
+    const Centimetres need = lengthOf(res) + Sailing::VEHICLE_BUF_CM;
+    if (high) { room.high -= need; room.highTaken += need; }
+    else      { room.low  -= need; room.lowTaken  += need; }
+}
+
+bool Reassignment::place(Reservation& res, std::vector<Room>& rooms) {
+    for (Room& room : rooms) {
+        bool high;
+        if (long(res.currentPeopleOccupants) > room.people
+         || !chooseLane(room, res, false, high))
+            continue;
+
+        // a vehicle already booked on this sailing keeps that booking only
+        Reservation existing;
+        if (ReservationIO::findReservation(room.id, res.currentVehicleLicense.view(), existing))
+            continue;
+
+        take(room, res, high);
+        room.people         -= res.currentPeopleOccupants;
+        res.currentSailingID = room.id;
+        res.usedHighLane     = high;
+        res.checkedIn        = false;
+        return true;
+    }
+    return false;
+}
+
+void Reassignment::pack(const std::vector<Reservation>& vehicles, Room& room, bool keepLanes,
+                        std::vector<Reservation>& placed, std::vector<Reservation>& overflow) {
+    for (const Reservation& res : vehicles) {
+        bool high;
+        if (!chooseLane(room, res, keepLanes && res.usedHighLane, high)) {
+            overflow.push_back(res);
+            continue;
+        }
+        take(room, res, high);
+        placed.push_back(res);
+        placed.back().usedHighLane = high;
+    }
+}
+
+bool Reassignment::chooseMoves(const std::vector<Reservation>& candidates,
+                               Centimetres atLeast, Centimetres atMost,
+                               std::vector<size_t>& chosen) {
+    std::vector<Centimetres> size(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i)
+        size[i] = lengthOf(candidates[i]) + Sailing::VEHICLE_BUF_CM;
+
+    // 1) First-fit decreasing
+    chosen.clear();
+    Centimetres sum = 0;
+    for (size_t i = 0; i < size.size() && sum < atLeast; ++i)
+        if (sum + size[i] <= atMost) { sum += size[i]; chosen.push_back(i); }
+    if (sum >= atLeast) return true;
+
+    // 2) Depth-first over the same order; equal lengths at one depth are
+    //    tried once, and branches that cannot reach `atLeast` are cut
+    std::vector<Centimetres> suffix(size.size() + 1, 0);
+    for (size_t i = size.size(); i-- > 0;) suffix[i] = suffix[i + 1] + size[i];
+    size_t steps = 0;
+    chosen.clear();
+    auto search = [&](auto& self, size_t from, Centimetres total) -> bool {
+        if (total >= atLeast) return true;
+        if (++steps > SEARCH_BUDGET || total + suffix[from] < atLeast) return false;
+        for (size_t i = from; i < size.size(); ++i) {
+            if ((i > from && size[i] == size[i - 1]) || total + size[i] > atMost) continue;
+            chosen.push_back(i);
+            if (self(self, i + 1, total + size[i])) return true;
+            chosen.pop_back();
+        }
+        return false;
+    };
+    return search(search, 0, 0);
+}
+
+//------
+// Description:
+// Moves every reservation of a sailing onto alternatives and deletes it.
+// Precondition:
+// Vessel, Sailing, Vehicle and Reservation subsystems initialised
+bool Reassignment::cancelSailing(std::string_view sailingID,
+                                 const std::vector<std::string>& alternatives,
+                                 Outcome& outcome)
+{
+    STATS_SCOPE(CANCEL_SAILING);
+    Trace::recordCancelSailing(sailingID, alternatives);
+    outcome = Outcome();
+    if (!Sailing::checkSailingExists(sailingID)) return false;
+
+    // 1) The manifest, in one pass over the sailing's shard
+    std::vector<Reservation> manifest;
+    if (!ReservationIO::readReservationsForSailing(sailingID, manifest)) return false;
+
+    // 2) Room left on each alternative, skipping repeats and unknown IDs
+    std::vector<Room> rooms;
+    for (const std::string& id : alternatives) {
+        bool seen = id == sailingID;
+        for (const Room& room : rooms) seen = seen || room.id == id;
+        Room room;
+        if (!seen && loadRoom(id, room)) rooms.push_back(room);
+    }
+
+    // 3) Place every vehicle in memory, first-fit decreasing
+    sortForPacking(manifest);
+    std::vector<Reservation> before;   // the moved reservations as they were
+    for (const Reservation& res : manifest) {
+        Reservation moved = res;
+        if (place(moved, rooms)) {
+            before.push_back(res);
+            outcome.moved.push_back(moved);
+        } else {
+            outcome.unplaced.push_back(res);
+        }
+    }
+
+    // 4) Claim the lane space, move the records in one batch, then
+    //    delete the sailing; a failed move gives the space back
+    bool ok = true;
+    std::vector<const Room*> claimed;
+    for (const Room& room : rooms) {
+        if (room.highTaken == 0 && room.lowTaken == 0) continue;
+        ok = SailingIO::claimLanes(room.id, room.highTaken, room.lowTaken);
+        if (!ok) break;
+        claimed.push_back(&room);
+    }
+    if (!ok || !ReservationIO::replaceSailingReservations(sailingID, outcome.moved)) {
+        for (const Room* room : claimed)
+            SailingIO::claimLanes(room->id, -room->highTaken, -room->lowTaken);
+        outcome = Outcome();
+        return false;
+    }
+
+    // 5) Keep the revenue ledger in step with the files, then delete the
+    //    emptied sailing; the moves stand even if that fails
+    for (size_t i = 0; i < before.size(); ++i) {
+        RevenueLedger::recordCancellation(sailingID, before[i].currentFare,
+                                          before[i].usedHighLane, before[i].checkedIn);
+        RevenueLedger::recordBooking(outcome.moved[i].currentSailingID.view(),
+                                     outcome.moved[i].currentFare,
+                                     outcome.moved[i].usedHighLane);
+    }
+    for (const Reservation& res : outcome.unplaced)
+        RevenueLedger::recordCancellation(sailingID, res.currentFare,
+                                          res.usedHighLane, res.checkedIn);
+    outcome.sailingDeleted = SailingIO::deleteSailing(sailingID);
+    return true;
+}
+
+//------
+// Description:
+// Prints where the reservations of a cancelled sailing went.
+// Precondition:
+// VehicleIO open
+void Reassignment::printOutcome(std::string_view sailingID,
+                                const Outcome& outcome,
+                                std::ostream& out)
+{
+    std::map<std::string, size_t> perSailing;
+    for (const Reservation& res : outcome.moved)
+        ++perSailing[std::string(res.currentSailingID.view())];
+
+    out << "Sailing " << sailingID << " cancelled: "
+        << outcome.moved.size() << " reservation(s) moved, "
+        << outcome.unplaced.size() << " could not be placed\n";
+    if (!outcome.sailingDeleted)
+        out << "Warning: " << sailingID << " is still listed and must be deleted again\n";
+    for (const auto& kv : perSailing)
+        out << "  " << std::left << std::setw(12) << kv.first << kv.second << "\n";
+    if (outcome.unplaced.empty()) return;
+
+    out << "\n" << std::left << std::setw(12) << "License"
+        << std::setw(11) << "Occupants"
+        << "Phone\n"
+        << std::string(38, '=') << "\n";
+    for (const Reservation& res : outcome.unplaced) {
+        std::string phone;
+        VehicleIO::getVehiclePhone(res.currentVehicleLicense.view(), phone);
+        out << std::setw(12) << res.currentVehicleLicense.view()
+            << std::setw(11) << res.currentPeopleOccupants
+            << phone << "\n";
+    }
+}
+
+//------
+// Description:
+// Puts another vessel on a sailing if its manifest fits.
+// Precondition:
+// Vessel, Sailing and Reservation subsystems initialised
+bool Reassignment::substituteVessel(std::string_view sailingID,
+                                    std::string_view vesselName,
+                                    Substitution& result)
+{
+    STATS_SCOPE(SUBSTITUTE_VESSEL);
+    Trace::recordSubstituteVessel(sailingID, vesselName);
+    result = Substitution();
+    Sailing::Record rec;
+    VesselRecord    vessel;
+    if (!SailingIO::readSailing(sailingID, rec)
+     || !VesselIO::readVessel(vesselName, vessel))
+        return false;
+
+    // 1) The manifest, in one pass over the sailing's shard
+    std::vector<Reservation> manifest;
+    if (!ReservationIO::readReservationsForSailing(sailingID, manifest)) return false;
+    sortForPacking(manifest);
+
+    // 2) Passengers: those checked in are on board, the rest still to come
+    long passengers = rec.ppl_on_board;
+    for (const Reservation& res : manifest)
+        if (!res.checkedIn) passengers += res.currentPeopleOccupants;
+    result.passengerOverflow = std::max(0L, passengers - long(vessel.maxPassengers));
+
+    // 3) Pack the new deck keeping every lane; if vehicles are left over,
+    //    pack again by the booking rules and keep whichever fits more
+    Room empty;
+    empty.high = vessel.highLaneCm;
+    empty.low  = vessel.lowLaneCm;
+    Room deck = empty;
+    std::vector<Reservation> placed;
+    pack(manifest, deck, true, placed, result.overflow);
+    if (!result.overflow.empty()) {
+        Room other = empty;
+        std::vector<Reservation> otherPlaced, otherOverflow;
+        pack(manifest, other, false, otherPlaced, otherOverflow);
+        if (otherOverflow.size() < result.overflow.size()) {
+            deck = other;
+            placed.swap(otherPlaced);
+            result.overflow.swap(otherOverflow);
+        }
+    }
+    if (!result.overflow.empty() || result.passengerOverflow > 0) return false;
+
+    // 4) Rewrite the vehicles that change lane, then the sailing record;
+    //    if the record cannot be written the lanes are put back
+    std::vector<Reservation> before;
+    for (size_t i = 0; i < placed.size(); ++i) {
+        if (placed[i].usedHighLane == manifest[i].usedHighLane) continue;
+        before.push_back(manifest[i]);
+        result.switched.push_back(placed[i]);
+    }
+    if (!ReservationIO::updateReservations(sailingID, result.switched)
+     || !SailingIO::changeVessel(sailingID, vessel, deck.high, deck.low)) {
+        ReservationIO::updateReservations(sailingID, before);
+        result.switched.clear();
+        return false;
+    }
+
+    // 5) The ledger counts bookings per lane
+    for (size_t i = 0; i < before.size(); ++i) {
+        const Reservation& res = result.switched[i];
+        RevenueLedger::recordCancellation(sailingID, before[i].currentFare,
+                                          before[i].usedHighLane, before[i].checkedIn);
+        RevenueLedger::recordBooking(sailingID, res.currentFare, res.usedHighLane);
+        if (res.checkedIn) RevenueLedger::recordCheckIn(sailingID, res.currentFare);
+    }
+    return true;
+}
+
+//------
+// Description:
+// Prints the result of a vessel substitution.
+// Precondition:
+// None
+void Reassignment::printSubstitution(std::string_view sailingID,
+                                     std::string_view vesselName,
+                                     const Substitution& result,
+                                     std::ostream& out)
+{
+    if (result.overflow.empty() && result.passengerOverflow == 0) {
+        out << vesselName << " now sails " << sailingID << "; "
+            << result.switched.size() << " vehicle(s) change lane\n";
+        for (const Reservation& res : result.switched)
+            out << "  " << std::left << std::setw(12) << res.currentVehicleLicense.view()
+                << (res.usedHighLane ? "low -> high" : "high -> low") << "\n";
+        return;
+    }
+    out << vesselName << " cannot take " << sailingID << ":\n";
+    if (result.passengerOverflow > 0)
+        out << "  " << result.passengerOverflow << " booked passenger(s) over its limit\n";
+    for (const Reservation& res : result.overflow)
+        out << "  " << std::left << std::setw(12) << res.currentVehicleLicense.view()
+            << toMetres(lengthOf(res)) << " m does not fit\n";
+}
+
+//------
+// Description:
+// Moves booked vehicles between lanes to make room for one more.
+// Precondition:
+// Sailing and Reservation subsystems initialised
+bool Reassignment::makeLaneRoom(std::string_view sailingID,
+                                Centimetres height,
+                                Centimetres length,
+                                bool& high,
+                                LaneMoves& moves)
+{
+    STATS_SCOPE(MAKE_LANE_ROOM);
+    moves = LaneMoves();
+    const Centimetres need = length + Sailing::VEHICLE_BUF_CM;
+    Sailing::Record rec;
+    // moving vehicles only shifts space between lanes, so the deck as a
+    // whole must already have it
+    if (!SailingIO::readSailing(sailingID, rec) || rec.HRL_cm + rec.LRL_cm < need)
+        return false;
+
+    std::vector<Reservation> manifest;
+    if (!ReservationIO::readReservationsForSailing(sailingID, manifest)) return false;
+    sortForPacking(manifest);
+
+    // a tall vehicle needs the high lane; others try the low lane first
+    const bool tall = height > Reservation::LOW_LANE_HEIGHT_CM;
+    for (bool target : {false, true}) {
+        if (tall && !target) continue;
+        const Centimetres free  = target ? rec.HRL_cm : rec.LRL_cm;
+        const Centimetres other = target ? rec.LRL_cm : rec.HRL_cm;
+
+        std::vector<Reservation> candidates;
+        for (const Reservation& res : manifest)
+            if (res.usedHighLane == target && !res.checkedIn && !isTall(res))
+                candidates.push_back(res);
+        std::vector<size_t> chosen;
+        if (!chooseMoves(candidates, need - free, other, chosen)) continue;
+
+        std::vector<Reservation> moved;
+        Centimetres shifted = 0;
+        for (size_t i : chosen) {
+            moved.push_back(candidates[i]);
+            moved.back().usedHighLane = !target;
+            shifted += lengthOf(candidates[i]) + Sailing::VEHICLE_BUF_CM;
+        }
+        const Centimetres toHigh = target ? -shifted : shifted;
+        if (!SailingIO::claimLanes(sailingID, toHigh, -toHigh)) return false;
+        if (!ReservationIO::updateReservations(sailingID, moved)) {
+            SailingIO::claimLanes(sailingID, -toHigh, toHigh);
+            return false;
+        }
+        for (const Reservation& res : moved) {
+            RevenueLedger::recordCancellation(sailingID, res.currentFare, target, false);
+            RevenueLedger::recordBooking(sailingID, res.currentFare, !target);
+        }
+        high              = target;
+        moves.moved       = std::move(moved);
+        moves.highClaimed = toHigh;
+        return true;
+    }
+    return false;
+}
+
+//------
+// Description:
+// Reverses makeLaneRoom().
+// Precondition:
+// `moves` came from makeLaneRoom() on `sailingID`
+bool Reassignment::undoLaneRoom(std::string_view sailingID, const LaneMoves& moves)
+{
+    if (moves.moved.empty()) return true;
+    std::vector<Reservation> back = moves.moved;
+    for (Reservation& res : back) res.usedHighLane = !res.usedHighLane;
+    if (!ReservationIO::updateReservations(sailingID, back)) return false;
+    if (!SailingIO::claimLanes(sailingID, -moves.highClaimed, moves.highClaimed)) {
+        ReservationIO::updateReservations(sailingID, moves.moved);
+        return false;
+    }
+    for (const Reservation& res : back) {
+        RevenueLedger::recordCancellation(sailingID, res.currentFare, !res.usedHighLane, false);
+        RevenueLedger::recordBooking(sailingID, res.currentFare, res.usedHighLane);
+    }
+    return true;
+}
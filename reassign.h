@@ -0,0 +1,219 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// reassign.h
+// Description:
+// Bulk moves of reservations between sailings. cancelSailing() takes a
+// sailing out of service (a vessel breakdown, say): it reads the
+// sailing's manifest with one pass over its reservation shard, places
+// every vehicle on the alternative sailings in memory, writes the result
+// as one batch and deletes the sailing. Vehicles no alternative can take
+// are cancelled and reported so agents can call their owners.
+//
+// substituteVessel() puts another vessel on a scheduled sailing. It
+// recomputes the lane remainders and passenger headroom from the
+// sailing's manifest against the new vessel, moving vehicles between
+// the high and low lanes where the new deck needs it, and commits only
+// if everything fits; otherwise it reports the overflow and changes
+// nothing.
+//
+// makeLaneRoom() is the booking fallback: when a vehicle fits in
+// neither lane of a sailing, it looks for booked vehicles low enough for
+// either lane whose move to the other lane frees the space, and moves
+// them. Bookings that fit as they are never reach it.
+//
+// Placement works on a snapshot of each alternative's lane and passenger
+// room and follows the booking rules: vehicles taller than the low lane
+// go high, the rest low first, and a sailing's passengers may not
+// exceed its vessel. Vehicles are placed first-fit decreasing (tall
+// vehicles, which have one lane to choose from, then the longest first)
+// over the alternatives in the caller's order of preference. Moved
+// reservations keep their fare and are booked, not checked in, on their
+// new sailing.
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - substituteVessel
+// Rev. 3 - 2025/09/02 - Team 12
+// - makeLaneRoom
+// Rev. 4 - 2025/09/02 - Team 12
+// - Outcome::sailingDeleted
+// Rev. 5 - 2025/09/02 - Team 12
+// - makeLaneRoom reports its moves; undoLaneRoom
+//*******************************
+
+#ifndef REASSIGN_H
+#define REASSIGN_H
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "reservation.h"
+#include "units.h"
+
+class Reassignment {
+public:
+    // What cancelSailing() did with each reservation of the sailing
+    struct Outcome {
+        std::vector<Reservation> moved;      // as booked on their new sailing
+        std::vector<Reservation> unplaced;   // cancelled: no alternative had room
+        bool sailingDeleted = false;         // false if the emptied sailing is still listed
+    };
+
+    // What substituteVessel() found
+    struct Substitution {
+        std::vector<Reservation> switched;       // moved to the other lane, as rewritten
+        std::vector<Reservation> overflow;       // vehicles the new vessel cannot take
+        long                     passengerOverflow = 0;   // booked passengers beyond its limit
+    };
+
+    // What makeLaneRoom() moved, so a booking that fails afterwards can
+    // put it back with undoLaneRoom()
+    struct LaneMoves {
+        std::vector<Reservation> moved;           // as rewritten, in their new lane
+        Centimetres              highClaimed = 0; // taken from the high lane, given to the low
+    };
+
+    //------
+    // Description:
+    // Moves every reservation of `sailingID` onto `alternatives`, cancels
+    // those that do not fit anywhere and deletes the sailing. Nothing is
+    // written until every vehicle has been placed in memory. Returns true
+    // once the reservations are moved; `outcome` says where each went and
+    // whether the sailing itself could then be deleted.
+    // Precondition:
+    // Vessel, Sailing, Vehicle and Reservation subsystems initialised
+    static bool cancelSailing(
+        std::string_view sailingID,                   // [in] Sailing to cancel
+        const std::vector<std::string>& alternatives, // [in] Sailings to move to, preferred first
+        Outcome& outcome                              // [out] Moved and unplaced reservations
+    );
+
+    //------
+    // Description:
+    // Prints how many reservations moved to each sailing, then the
+    // license, occupants and phone number of every vehicle that could
+    // not be placed.
+    // Precondition:
+    // VehicleIO open
+    static void printOutcome(
+        std::string_view sailingID,  // [in] Cancelled sailing
+        const Outcome& outcome,      // [in] Result of cancelSailing
+        std::ostream& out            // [in] Destination
+    );
+
+    //------
+    // Description:
+    // Puts `vesselName` on `sailingID`. The sailing's reservations are
+    // packed onto the new vessel's lanes, keeping each vehicle in its
+    // lane where possible and otherwise placing them by the booking
+    // rules; the lane changes and the sailing record are then written.
+    // Returns false, writing nothing, if a vehicle or the booked
+    // passengers do not fit; `result` lists them.
+    // Precondition:
+    // Vessel, Sailing and Reservation subsystems initialised
+    static bool substituteVessel(
+        std::string_view sailingID,   // [in] Sailing to change
+        std::string_view vesselName,  // [in] Vessel to put on it
+        Substitution& result          // [out] Lane changes or overflow
+    );
+
+    //------
+    // Description:
+    // Prints the lane changes of a substitution, or the vehicles and
+    // passengers that kept it from happening.
+    // Precondition:
+    // None
+    static void printSubstitution(
+        std::string_view sailingID,   // [in] Sailing changed
+        std::string_view vesselName,  // [in] Vessel put on it
+        const Substitution& result,   // [in] Result of substituteVessel
+        std::ostream& out             // [in] Destination
+    );
+
+    //------
+    // Description:
+    // Frees lane space on `sailingID` for a vehicle that fits in neither
+    // lane by moving booked vehicles, not yet checked in and low enough
+    // for either lane, into the other lane. Moved vehicles keep their
+    // fare. Returns true, with the lane that now has room in `high`, if
+    // such a set of vehicles is found; the vehicle itself is not booked.
+    // Precondition:
+    // Sailing and Reservation subsystems initialised
+    static bool makeLaneRoom(
+        std::string_view sailingID,  // [in] Sailing to book on
+        Centimetres height,          // [in] Vehicle height, 0 for a regular vehicle
+        Centimetres length,          // [in] Vehicle length
+        bool& high,                  // [out] Lane to book it in
+        LaneMoves& moves             // [out] Vehicles moved to make the room
+    );
+
+    //------
+    // Description:
+    // Puts the vehicles moved by makeLaneRoom() back in their lanes and
+    // returns the lane space. Returns true if successful.
+    // Precondition:
+    // `moves` came from makeLaneRoom() on `sailingID`, with no booking
+    // on the room it made
+    static bool undoLaneRoom(
+        std::string_view sailingID,  // [in] Sailing the room was made on
+        const LaneMoves& moves       // [in] What makeLaneRoom() moved
+    );
+
+private:
+    // Steps chooseMoves() may take before giving up
+    static constexpr size_t SEARCH_BUDGET = 4096;
+
+    // Room left on one alternative while vehicles are placed in memory
+    struct Room {
+        std::string id;
+        Centimetres high      = 0;   // lane length left, buffers included
+        Centimetres low       = 0;
+        long        people    = 0;   // passengers it can still take
+        Centimetres highTaken = 0;   // claimed by this run
+        Centimetres lowTaken  = 0;
+    };
+
+    // Snapshot of the room left on `sailingID`; false if it does not exist
+    static bool loadRoom(std::string_view sailingID, Room& out);
+
+    // Lane length a reservation's vehicle occupies, without its buffer
+    static Centimetres lengthOf(const Reservation& res);
+
+    // True if the vehicle is too tall for the low lane
+    static bool isTall(const Reservation& res);
+
+    // Order in which vehicles are packed: tall ones first, as they have
+    // one lane to choose from, then the longest first
+    static void sortForPacking(std::vector<Reservation>& vehicles);
+
+    // Picks the lane of `room` for `res`: the high lane for tall vehicles,
+    // otherwise the preferred lane and then the other. False if neither fits.
+    static bool chooseLane(const Room& room, const Reservation& res,
+                           bool preferHigh, bool& high);
+
+    // Takes the vehicle's length and buffer from one lane of `room`
+    static void take(Room& room, const Reservation& res, bool high);
+
+    // Books `res` onto the first room that takes it, updating the room,
+    // its sailing ID and lane. Returns false if none does.
+    static bool place(Reservation& res, std::vector<Room>& rooms);
+
+    // Packs `vehicles` into one room in order, each in its current lane
+    // when `keepLanes` is set. Placed vehicles, with their lane, go to
+    // `placed`; the rest to `overflow`.
+    static void pack(const std::vector<Reservation>& vehicles, Room& room, bool keepLanes,
+                     std::vector<Reservation>& placed, std::vector<Reservation>& overflow);
+
+    // Picks vehicles from `candidates`, sorted longest first, whose lane
+    // space (buffers included) adds up to between `atLeast` and `atMost`:
+    // first-fit decreasing, then a bounded exact search. Indices go to
+    // `chosen`; false if neither finds a set.
+    static bool chooseMoves(const std::vector<Reservation>& candidates,
+                            Centimetres atLeast, Centimetres atMost,
+                            std::vector<size_t>& chosen);
+};
+
+#endif // REASSIGN_H
@@ -0,0 +1,118 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// reassignTest.cpp
+// Description:
+// Unit test driver for Reassignment::cancelSailing. Cancels a sailing
+// whose vehicles fill more than its alternatives can take and checks
+// where each one went.
+//
+// Test Case:
+// 1. Tall vehicles go to a high lane, the rest fill the preferred
+//    alternative before the next one
+// 2. Vehicles no alternative has room for are reported as unplaced
+// 3. Moved bookings are on their new sailing, not checked in, and the
+//    lanes they took are subtracted there
+// 4. The cancelled sailing is deleted
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+//*******************************
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "reassign.h"
+#include "reservation_io.h"
+#include "sailing_io.h"
+#include "vehicle.h"
+#include "vessel.h"
+
+namespace {
+    bool fail(const std::string& why) {
+        std::cerr << why << "\n";
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        return false;
+    }
+
+    // True if `sailingID` has `count` bookings and lanes `hrl`/`lrl` left
+    bool holds(std::string_view sailingID, size_t count, Centimetres hrl, Centimetres lrl) {
+        std::vector<Reservation> booked;
+        Sailing::Record rec;
+        if (!ReservationIO::readReservationsForSailing(sailingID, booked)
+         || !SailingIO::readSailing(sailingID, rec))
+            return false;
+        for (const Reservation& res : booked)
+            if (res.fields().checkedIn) return false;
+        return booked.size() == count && rec.HRL_cm == hrl && rec.LRL_cm == lrl;
+    }
+
+    bool run() {
+        if (!Vessel::init() || !Sailing::init() || !Reservation::init() || !Vehicle::init())
+            return fail("cannot create the data files");
+
+        // Each lane of "Small" takes two regular vehicles (7 m + 0.5 m
+        // buffer each) or one 10 m tall one
+        if (!Vessel::createVessel("Big", 200, 40.0f, 40.0f)
+         || !Vessel::createVessel("Small", 200, 16.0f, 16.0f)
+         || !Sailing::createSailing("Big", "AAA", "05", "08")
+         || !Sailing::createSailing("Small", "BBB", "05", "09")
+         || !Sailing::createSailing("Small", "CCC", "05", "10"))
+            return fail("cannot create the sailings");
+        if (!Reservation::createSpecialReservation("AAA-05-08", "TALL1", 1, "604-555-0101",
+                                                   2.5f, 10.0f))
+            return fail("cannot book the tall vehicle");
+        for (int i = 1; i <= 7; ++i) {
+            if (!Reservation::createReservation("AAA-05-08", "REG" + std::to_string(i), 2,
+                                                "604-555-0102"))
+                return fail("cannot book REG" + std::to_string(i));
+        }
+
+        Reassignment::Outcome outcome;
+        if (!Reassignment::cancelSailing("AAA-05-08", {"BBB-05-09", "CCC-05-10"}, outcome))
+            return fail("cancelSailing failed");
+
+        // Test 1: the tall vehicle takes BBB's high lane
+        bool tallPlaced = false;
+        for (const Reservation& res : outcome.moved) {
+            const Reservation::Fields f = res.fields();
+            if (f.license == "TALL1")
+                tallPlaced = f.sailingID == "BBB-05-09" && f.usedHighLane;
+        }
+        if (!tallPlaced) return fail("TALL1 not in BBB-05-09's high lane");
+
+        // Test 2: BBB takes 3, CCC 4; one regular vehicle is left over
+        if (outcome.moved.size() != 7 || outcome.unplaced.size() != 1)
+            return fail(std::to_string(outcome.moved.size()) + " moved, "
+                        + std::to_string(outcome.unplaced.size()) + " unplaced");
+
+        // Test 3: bookings and lane remainders on the alternatives
+        if (!holds("BBB-05-09", 3, 1600 - 1050, 1600 - 2 * 750))
+            return fail("BBB-05-09 does not hold TALL1 and two regular vehicles");
+        if (!holds("CCC-05-10", 4, 1600 - 2 * 750, 1600 - 2 * 750))
+            return fail("CCC-05-10 does not hold four regular vehicles");
+
+        // Test 4: the cancelled sailing is gone
+        if (!outcome.sailingDeleted || Sailing::checkSailingExists("AAA-05-08"))
+            return fail("AAA-05-08 was not deleted");
+
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+        return true;
+    }
+}
+
+//------
+// Description:
+// Main test driver function
+int reassignTest() {
+    std::cout << "Starting cancelSailing test...\n";
+    if (!run()) return 1;
+    std::cout << "cancelSailing test: Pass\n";
+    return 0;
+}
@@ -0,0 +1,137 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// recordFileTest.cpp
+// Description:
+// Unit test driver for the free-slot list of RecordFile and its use by
+// ReservationIO. Checks that freed slots are reused before the file
+// grows, that the list survives a reopen, and that a link left pointing
+// at a live record is repaired rather than followed.
+//
+// Test Case:
+// 1. Released slots are reused, most recently freed first, before
+//    inserts append
+// 2. Counts and the list survive closing and reopening the file
+// 3. A free-list head pointing at a live slot is rebuilt; the live
+//    record is not overwritten
+// 4. A deleted reservation's slot takes the next booking without the
+//    shard growing
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+//*******************************
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include "record_file.h"
+#include "reservation_io.h"
+
+namespace {
+    Reservation makeReservation(std::string_view sailingID, std::string_view license) {
+        Reservation::Fields f;
+        f.sailingID = sailingID;
+        f.license   = license;
+        f.fare      = 14.0f;
+        f.occupants = 2;
+        return Reservation::fromFields(f);
+    }
+
+    // License of the record in `slot`, or "" if the slot is free
+    std::string licenseAt(RecordFile& file, size_t slot) {
+        Reservation res;
+        file.stream().clear();
+        file.stream().seekg(file.slotOffset(slot), std::ios::beg);
+        if (!schema::readRecord(file.stream(), res) || !RecordFile::isLive(res)) return "";
+        return std::string(res.fields().license);
+    }
+
+    bool expectSlot(const char* what, size_t slot, size_t expected) {
+        if (slot == expected) return true;
+        std::cerr << what << ": went to slot " << slot << ", expected " << expected << "\n";
+        return false;
+    }
+}
+
+//------
+// Description:
+// Main test driver function
+int recordFileTest() {
+    std::cout << "Starting RecordFile free-slot test...\n";
+    RecordFile file("slots.dat", RecordFile::formatOf<Reservation>());
+    if (!file.open()) return 1;
+
+    // Test 1: Freed slots are filled before the file grows
+    size_t slot = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        if (!file.insert(makeReservation("AAA-01-08", "LIC" + std::to_string(i)), slot)
+         || !expectSlot("append", slot, i))
+            return 1;
+    }
+    if (!file.release(1) || !file.release(2)) return 1;
+    if (file.liveCount() != 2 || file.slotCount() != 4 || !licenseAt(file, 1).empty()) {
+        std::cerr << "release: " << file.liveCount() << " live of "
+                  << file.slotCount() << " slots\n";
+        return 1;
+    }
+
+    // Test 2: The list survives a reopen
+    file.close();
+    if (!file.open() || file.liveCount() != 2 || file.slotCount() != 4) {
+        std::cerr << "reopen: free-slot counts lost\n";
+        return 1;
+    }
+    if (!file.insert(makeReservation("AAA-01-08", "NEW2"), slot) || !expectSlot("reuse", slot, 2)
+     || !file.insert(makeReservation("AAA-01-08", "NEW1"), slot) || !expectSlot("reuse", slot, 1)
+     || !file.insert(makeReservation("AAA-01-08", "LIC4"), slot) || !expectSlot("append", slot, 4))
+        return 1;
+    if (licenseAt(file, 2) != "NEW2" || licenseAt(file, 3) != "LIC3") {
+        std::cerr << "reuse: records not where they were written\n";
+        return 1;
+    }
+
+    // Test 3: A head left on a live slot (a crash between writing a slot
+    //         and the header) is rebuilt from the slots themselves
+    if (!file.release(0)) return 1;
+    file.header().freeHead = 3;
+    if (!file.writeHeader()) return 1;
+    file.close();
+    if (!file.open()
+     || !file.insert(makeReservation("AAA-01-08", "NEW0"), slot) || !expectSlot("repair", slot, 0))
+        return 1;
+    if (licenseAt(file, 3) != "LIC3" || file.liveCount() != 5 || file.slotCount() != 5) {
+        std::cerr << "repair: live record overwritten or counts wrong\n";
+        return 1;
+    }
+    file.close();
+
+    // Test 4: ReservationIO frees a deleted booking's slot for the next one
+    if (!ReservationIO::open()) return 1;
+    for (const char* license : {"R1", "R2", "R3"}) {
+        if (!ReservationIO::createReservation(makeReservation("AAA-03-08", license))) return 1;
+    }
+    const std::string shard = ReservationIO::shardPath(ReservationIO::shardOf("AAA-03-08"));
+    if (!ReservationIO::flush()) return 1;
+    const auto sizeBefore = std::filesystem::file_size(shard);
+    Reservation found;
+    if (!ReservationIO::deleteReservation("AAA-03-08", "R2")
+     || !ReservationIO::createReservation(makeReservation("AAA-03-08", "R4"))
+     || !ReservationIO::flush()) {
+        ReservationIO::close();
+        return 1;
+    }
+    const auto sizeAfter = std::filesystem::file_size(shard);
+    bool ok = sizeAfter == sizeBefore
+           && !ReservationIO::findReservation("AAA-03-08", "R2", found)
+           && ReservationIO::findReservation("AAA-03-08", "R4", found)
+           && ReservationIO::findReservation("AAA-03-08", "R3", found);
+    ReservationIO::close();
+    if (!ok) {
+        std::cerr << "ReservationIO: shard went from " << sizeBefore << " to "
+                  << sizeAfter << " bytes or lost a booking\n";
+        return 1;
+    }
+
+    std::cout << "RecordFile free-slot test: Pass\n";
+    return 0;
+}
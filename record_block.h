@@ -0,0 +1,172 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// record_block.h
+// Description:
+// Block-buffered access to the slots of a RecordFile. RecordScanner reads
+// a block of consecutive slots with one seek and one read and hands it out
+// as an array of decoded records, so a scan costs one stream call per
+// block instead of a seek-and-read per 44-104 byte record. RecordAppender
+// collects new records and writes them at the end of the file a block at
+// a time, with one header update per block.
+//
+// A scanner reads ahead in a window that starts at 4 KiB and doubles with
+// each block up to its block size (64 KiB by default), so a lookup that
+// finds its record near the front of the file reads little more than
+// before, and a full scan soon moves in whole blocks. The operating
+// system's own readahead keeps the next block in the page cache.
+//
+// Typical scan:
+//     RecordScanner<Sailing::Record> scan(file);
+//     while (scan.nextBlock())
+//         for (size_t i = 0; i < scan.size(); ++i)
+//             if (matches(scan[i])) return scan.firstSlot() + i;
+//
+// Revision History:
+// Rev. 1 - 2025/08/31 - Team 12
+// - Initial implementation
+//*******************************
+
+#ifndef RECORD_BLOCK_H
+#define RECORD_BLOCK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include "record_file.h"
+#include "schema.h"
+#include "stats.h"
+
+// Default bytes read or written per block
+constexpr size_t RECORD_BLOCK_BYTES = 64 * 1024;
+
+// Bytes a scanner reads in its first block
+constexpr size_t RECORD_FIRST_BLOCK_BYTES = 4 * 1024;
+
+template <class R>
+class RecordScanner {
+public:
+    //------
+    // Description:
+    // Prepares to read slots firstSlot.. of `file` in blocks of up to
+    // `blockBytes`. Nothing is read until nextBlock().
+    // Precondition:
+    // File must be open
+    explicit RecordScanner(RecordFile& file,
+                           size_t blockBytes = RECORD_BLOCK_BYTES,
+                           size_t firstSlot = 0)
+        : recordFile(file),
+          nextSlot(firstSlot),
+          endSlot(file.slotCount()),
+          maxRecords(std::max<size_t>(1, blockBytes / RecordSchema<R>::SIZE)),
+          window(std::min(maxRecords, std::max<size_t>(1, RECORD_FIRST_BLOCK_BYTES
+                                                           / RecordSchema<R>::SIZE))) {}
+
+    //------
+    // Description:
+    // Reads the next block of slots. Returns false at the end of the file
+    // or if the read fails. Free slots are included; test them with
+    // RecordFile::isLive.
+    // Precondition:
+    // No other code moved the file's get position since the last call
+    // that needs to be kept
+    bool nextBlock() {
+        blockFirst = nextSlot;
+        count = 0;
+        if (nextSlot >= endSlot) return false;
+        size_t n = std::min(window, endSlot - nextSlot);
+        if (records.size() < n) records.resize(n);
+        window = std::min(maxRecords, window * 2);
+        std::fstream& in = recordFile.stream();
+        in.clear();
+        in.seekg(recordFile.slotOffset(nextSlot), std::ios::beg);
+        if (!schema::readRecords(in, records.data(), n)) return false;
+        STATS_READ(n * RecordSchema<R>::SIZE, n);
+        count = n;
+        nextSlot += n;
+        return true;
+    }
+
+    // The current block
+    size_t   size() const { return count; }
+    size_t   firstSlot() const { return blockFirst; }
+    R&       operator[](size_t i) { return records[i]; }
+    const R& operator[](size_t i) const { return records[i]; }
+    R*       begin() { return records.data(); }
+    R*       end() { return records.data() + count; }
+
+private:
+    RecordFile&    recordFile;
+    size_t         nextSlot;
+    size_t         endSlot;
+    size_t         maxRecords;   // records in a full block
+    size_t         window;       // records in the next block
+    size_t         blockFirst = 0;
+    size_t         count = 0;
+    std::vector<R> records;
+};
+
+template <class R>
+class RecordAppender {
+public:
+    //------
+    // Description:
+    // Prepares to append to `file` in blocks of about `blockBytes`.
+    // Precondition:
+    // File must be open
+    explicit RecordAppender(RecordFile& file, size_t blockBytes = RECORD_BLOCK_BYTES)
+        : recordFile(file),
+          perBlock(std::max<size_t>(1, blockBytes / RecordSchema<R>::SIZE)) {
+        bytes.reserve(perBlock * RecordSchema<R>::SIZE);
+    }
+
+    ~RecordAppender() { flush(); }
+
+    RecordAppender(const RecordAppender&) = delete;
+    RecordAppender& operator=(const RecordAppender&) = delete;
+
+    //------
+    // Description:
+    // Adds `rec` to the current block, writing the block once it is
+    // full. Returns false if a write failed.
+    // Precondition:
+    // rec's key is not empty
+    bool add(const R& rec) {
+        size_t at = bytes.size();
+        bytes.resize(at + RecordSchema<R>::SIZE);
+        schema::encode(rec, bytes.data() + at);
+        return bytes.size() < perBlock * RecordSchema<R>::SIZE || flush();
+    }
+
+    //------
+    // Description:
+    // Writes the buffered records after the last slot and counts them in
+    // the header. Returns true if successful.
+    // Precondition:
+    // None
+    bool flush() {
+        if (bytes.empty()) return ok;
+        const size_t n = bytes.size() / RecordSchema<R>::SIZE;
+        std::fstream& out = recordFile.stream();
+        out.clear();
+        out.seekp(recordFile.slotOffset(recordFile.slotCount()), std::ios::beg);
+        out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        STATS_WRITE(bytes.size());
+        ok = ok && out && recordFile.addLive(static_cast<int>(n)) && out.flush();
+        STATS_FLUSH();
+        written += n;
+        bytes.clear();
+        return ok;
+    }
+
+    // Records handed to add() and flushed so far
+    size_t count() const { return written; }
+
+private:
+    RecordFile&       recordFile;
+    size_t            perBlock;
+    size_t            written = 0;
+    bool              ok = true;
+    std::vector<char> bytes;
+};
+
+#endif // RECORD_BLOCK_H
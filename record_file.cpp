@@ -0,0 +1,372 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// record_file.cpp
+// Description:
+// Implementation of the RecordFile class: header creation, validation
+// and maintenance for the fixed-record data files.
+//
+// Revision History:
+// Rev. 1 - 2025/08/27 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/28 - Team 12
+// - Free-slot list
+// Rev. 3 - 2025/08/30 - Team 12
+// - Table-driven crc32, shared with the archive
+// Rev. 4 - 2025/08/31 - Team 12
+// - Rewrites through a synced temporary file and rename
+// Rev. 5 - 2025/09/02 - Team 12
+// - Slot count recovered from the file length after a torn append
+// Rev. 6 - 2025/09/02 - Team 12
+// - flush()
+// Rev. 7 - 2025/09/02 - Team 12
+// - open() recreates only a missing or empty file
+//*******************************
+
+#include "record_file.h"
+#include "stats.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define RECORD_FILE_FSYNC 1
+#endif
+
+namespace {
+    const char MAGIC[8] = "SETSAIL";
+
+    // Bytes of the encoded header covered by its checksum
+    const size_t CHECKED_BYTES = offsetof(FileHeader, checksum);
+
+    // CRC-32 (IEEE, reflected) lookup table
+    struct CrcTable {
+        uint32_t entry[256];
+        CrcTable() {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t crc = i;
+                for (int b = 0; b < 8; ++b)
+                    crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+                entry[i] = crc;
+            }
+        }
+    };
+
+    // Slots read per pass while rebuilding the free list
+    const size_t SCAN_SLOTS = 4096;
+
+    void storeLink(char* out, int32_t next) {
+        uint32_t v = static_cast<uint32_t>(next);
+        for (int i = 0; i < 4; ++i) out[i] = static_cast<char>((v >> (8 * i)) & 0xFF);
+    }
+
+    int32_t loadLink(const char* in) {
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) v |= uint32_t(static_cast<unsigned char>(in[i])) << (8 * i);
+        return static_cast<int32_t>(v);
+    }
+
+    // Forces `path` (a file, or a directory after a rename in it) to disk.
+    // Without fsync the flushed stream and the rename are all we have.
+    bool syncPath(const std::filesystem::path& path) {
+#if defined(RECORD_FILE_FSYNC)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        bool ok = ::fsync(fd) == 0;
+        ::close(fd);
+        STATS_FSYNC();
+        return ok;
+#else
+        (void)path;
+        return true;
+#endif
+    }
+
+    uint32_t checksumOf(const FileHeader& header) {
+        char buf[RecordFile::HEADER_SIZE];
+        schema::encode(header, buf);
+        return RecordFile::crc32(buf, CHECKED_BYTES);
+    }
+}
+
+uint32_t RecordFile::crc32(const char* data, size_t n) {
+    static const CrcTable table;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < n; ++i)
+        crc = (crc >> 8) ^ table.entry[(crc ^ static_cast<unsigned char>(data[i])) & 0xFF];
+    return ~crc;
+}
+
+RecordFile::RecordFile(const char* path, const Format& format)
+    : filePath(path), recordFormat(format), hdr(freshHeader(format)) {}
+
+FileHeader RecordFile::freshHeader(const Format& format) {
+    FileHeader header;
+    std::memset(&header, 0, sizeof header);
+    std::memcpy(header.magic, MAGIC, sizeof header.magic);
+    header.schemaHash    = format.schemaHash;
+    header.headerVersion = HEADER_VERSION;
+    header.schemaVersion = format.schemaVersion;
+    header.recordSize    = format.recordSize;
+    header.freeHead      = NO_SLOT;
+    return header;
+}
+
+bool RecordFile::writeHeader(std::ostream& out, FileHeader& header) {
+    header.checksum = checksumOf(header);
+    bool ok = schema::writeRecord(out, header);
+    STATS_WRITE(HEADER_SIZE);
+    return ok;
+}
+
+bool RecordFile::readHeader(std::istream& in, FileHeader& header) {
+    if (!schema::readRecord(in, header)) return false;
+    STATS_READ(HEADER_SIZE);
+    return std::memcmp(header.magic, MAGIC, sizeof header.magic) == 0;
+}
+
+std::string RecordFile::validate(const FileHeader& header, const Format& format,
+                                 std::streamoff fileSize) {
+    if (std::memcmp(header.magic, MAGIC, sizeof header.magic) != 0)
+        return "no file header (run setsail_migrate)";
+    if (header.checksum != checksumOf(header))
+        return "header checksum mismatch";
+    if (header.headerVersion != HEADER_VERSION)
+        return "unsupported header version " + std::to_string(header.headerVersion);
+    if (header.recordSize != format.recordSize)
+        return "record size " + std::to_string(header.recordSize) + ", expected "
+             + std::to_string(format.recordSize);
+    if (header.schemaHash != format.schemaHash || header.schemaVersion != format.schemaVersion)
+        return std::string("written with a different ") + format.name
+             + " schema (run setsail_migrate)";
+    std::streamoff expected = HEADER_SIZE + static_cast<std::streamoff>(
+        uint64_t(header.liveCount) + header.tombstoneCount) * header.recordSize;
+    if (fileSize >= 0 && fileSize != expected)
+        return "file is " + std::to_string(fileSize) + " bytes, header describes "
+             + std::to_string(expected);
+    return "";
+}
+
+bool RecordFile::open() {
+    if (fileStream.is_open()) return true;
+
+    // only a missing or empty file is started afresh; any other error
+    // leaves the file alone rather than truncating data we cannot read
+    std::error_code ec;
+    auto size = std::filesystem::file_size(filePath, ec);
+    if (ec == std::errc::no_such_file_or_directory || (!ec && size == 0)) return recreate();
+    if (ec) {
+        std::cerr << "Error: " << filePath << ": " << ec.message() << "\n";
+        return false;
+    }
+
+    fileStream.open(filePath, std::ios::in | std::ios::out | std::ios::binary);
+    if (!fileStream) {
+        std::cerr << "Error: cannot open " << filePath << "\n";
+        return false;
+    }
+    FileHeader found;
+    std::string problem = readHeader(fileStream, found)
+        ? validate(found, recordFormat, -1)
+        : validate(FileHeader{}, recordFormat, static_cast<std::streamoff>(size));
+    // a length off by whole slots is a write whose header never landed;
+    // anything else is damage
+    const std::streamoff length = static_cast<std::streamoff>(size);
+    const bool wholeSlots = length >= HEADER_SIZE
+                         && (length - HEADER_SIZE) % recordFormat.recordSize == 0;
+    if (problem.empty() && !wholeSlots)
+        problem = validate(found, recordFormat, length);
+    if (!problem.empty()) {
+        std::cerr << "Error: " << filePath << ": " << problem << "\n";
+        fileStream.close();
+        return false;
+    }
+    hdr = found;
+    if (slotOffset(slotCount()) != length) {
+        std::cerr << "Warning: " << filePath << ": header describes " << slotCount()
+                  << " slots, file holds " << slotAt(length) << "; recounting\n";
+        hdr.liveCount      = static_cast<uint32_t>(slotAt(length));
+        hdr.tombstoneCount = 0;
+        hdr.freeHead       = NO_SLOT;
+        if (!rebuildFreeList()) {
+            std::cerr << "Error: " << filePath << ": cannot recount slots\n";
+            fileStream.close();
+            return false;
+        }
+    }
+    bool listLooksSane = hdr.freeHead == NO_SLOT
+        ? hdr.tombstoneCount == 0
+        : hdr.tombstoneCount > 0 && hdr.freeHead >= 0
+          && static_cast<size_t>(hdr.freeHead) < slotCount();
+    if (!listLooksSane && !rebuildFreeList()) {
+        std::cerr << "Error: " << filePath << ": cannot rebuild free-slot list\n";
+        fileStream.close();
+        return false;
+    }
+    rewind();
+    return true;
+}
+
+void RecordFile::close() {
+    if (fileStream.is_open()) fileStream.close();
+}
+
+bool RecordFile::recreate() {
+    close();
+    fileStream.open(filePath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fileStream) {
+        std::cerr << "Error: cannot create " << filePath << "\n";
+        return false;
+    }
+    hdr = freshHeader(recordFormat);
+    if (!writeHeader(fileStream, hdr) || !fileStream.flush()) {
+        std::cerr << "Error: cannot write header of " << filePath << "\n";
+        close();
+        return false;
+    }
+    STATS_FLUSH();
+    rewind();
+    return true;
+}
+
+bool RecordFile::beginReplace(const std::string& path, FileHeader& header, std::ofstream& out) {
+    out.open(path + ".tmp", std::ios::binary | std::ios::trunc);
+    if (!out || !writeHeader(out, header)) {
+        std::cerr << "Error: cannot write " << path << ".tmp\n";
+        return false;
+    }
+    return true;
+}
+
+bool RecordFile::finishReplace(const std::string& path, std::ofstream& out) {
+    const std::string tmp = path + ".tmp";
+    out.close();
+    std::error_code ec;
+    if (out.fail() || !syncPath(tmp)) {
+        std::cerr << "Error: cannot write " << tmp << "\n";
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        std::cerr << "Error: cannot replace " << path << ": " << ec.message() << "\n";
+        std::filesystem::remove(tmp, ec);
+        return false;
+    }
+    // make the rename itself durable
+    std::filesystem::path dir = std::filesystem::path(path).parent_path();
+    syncPath(dir.empty() ? std::filesystem::path(".") : dir);
+    return true;
+}
+
+bool RecordFile::release(size_t slot) {
+    if (!fileStream.is_open() || slot >= slotCount()) return false;
+    std::vector<char> blank(recordFormat.recordSize, 0);
+    storeLink(blank.data() + FREE_LINK_OFFSET, hdr.freeHead);
+    fileStream.clear();
+    fileStream.seekp(slotOffset(slot), std::ios::beg);
+    if (!fileStream.write(blank.data(), static_cast<std::streamsize>(blank.size()))) return false;
+    STATS_WRITE(blank.size());
+    hdr.freeHead = static_cast<int32_t>(slot);
+    ++hdr.tombstoneCount;
+    --hdr.liveCount;
+    return writeHeader();
+}
+
+bool RecordFile::takeSlot(size_t& slot, FileHeader& before) {
+    if (!fileStream.is_open()) return false;
+    int32_t next = NO_SLOT;
+    if (hdr.freeHead != NO_SLOT && !readLink(static_cast<size_t>(hdr.freeHead), next)) {
+        if (!rebuildFreeList()) return false;
+        if (hdr.freeHead != NO_SLOT && !readLink(static_cast<size_t>(hdr.freeHead), next))
+            return false;
+    }
+    before = hdr;
+    if (hdr.freeHead == NO_SLOT) {
+        slot = slotCount();
+    } else {
+        slot = static_cast<size_t>(hdr.freeHead);
+        hdr.freeHead = next;
+        --hdr.tombstoneCount;
+    }
+    ++hdr.liveCount;
+    return true;
+}
+
+bool RecordFile::readLink(size_t slot, int32_t& next) {
+    if (slot >= slotCount()) return false;
+    char head[FREE_LINK_OFFSET + 4];
+    fileStream.clear();
+    fileStream.seekg(slotOffset(slot), std::ios::beg);
+    if (!fileStream.read(head, sizeof head)) return false;
+    STATS_READ(sizeof head);
+    next = loadLink(head + FREE_LINK_OFFSET);
+    if (head[0] != '\0') return false;
+    return next == NO_SLOT
+        || (next >= 0 && static_cast<size_t>(next) < slotCount()
+            && static_cast<size_t>(next) != slot);
+}
+
+bool RecordFile::rebuildFreeList() {
+    const size_t slots = slotCount();
+    const size_t size  = recordFormat.recordSize;
+    std::vector<size_t> freeSlots;
+    std::vector<char>   bytes(SCAN_SLOTS * size);
+    fileStream.clear();
+    fileStream.seekg(HEADER_SIZE, std::ios::beg);
+    for (size_t first = 0; first < slots; first += SCAN_SLOTS) {
+        size_t n = std::min(SCAN_SLOTS, slots - first);
+        if (!fileStream.read(bytes.data(), static_cast<std::streamsize>(n * size))) return false;
+        STATS_READ(n * size, n);
+        for (size_t i = 0; i < n; ++i)
+            if (bytes[i * size] == '\0') freeSlots.push_back(first + i);
+    }
+
+    // Link in ascending order so the lowest holes are filled first
+    int32_t next = NO_SLOT;
+    char link[4];
+    for (auto it = freeSlots.rbegin(); it != freeSlots.rend(); ++it) {
+        storeLink(link, next);
+        fileStream.clear();
+        fileStream.seekp(slotOffset(*it) + static_cast<std::streamoff>(FREE_LINK_OFFSET),
+                         std::ios::beg);
+        if (!fileStream.write(link, sizeof link)) return false;
+        STATS_WRITE(sizeof link);
+        next = static_cast<int32_t>(*it);
+    }
+    hdr.freeHead       = next;
+    hdr.tombstoneCount = static_cast<uint32_t>(freeSlots.size());
+    hdr.liveCount      = static_cast<uint32_t>(slots - freeSlots.size());
+    if (!writeHeader() || !fileStream.flush()) return false;
+    STATS_FLUSH();
+    return true;
+}
+
+bool RecordFile::addLive(int delta) {
+    hdr.liveCount = static_cast<uint32_t>(static_cast<int64_t>(hdr.liveCount) + delta);
+    return writeHeader();
+}
+
+bool RecordFile::writeHeader() {
+    if (!fileStream.is_open()) return false;
+    fileStream.clear();
+    fileStream.seekp(0, std::ios::beg);
+    return writeHeader(fileStream, hdr);
+}
+
+bool RecordFile::flush() {
+    if (!fileStream.is_open()) return true;
+    fileStream.clear();
+    bool ok = static_cast<bool>(fileStream.flush());
+    STATS_FLUSH();
+    return ok;
+}
+
+void RecordFile::rewind() {
+    fileStream.clear();
+    fileStream.seekg(HEADER_SIZE, std::ios::beg);
+    fileStream.seekp(HEADER_SIZE, std::ios::beg);
+}
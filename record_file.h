@@ -0,0 +1,341 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// record_file.h
+// Description:
+// A fixed-record data file with a 64-byte header in front of its record
+// slots. The header identifies the file (magic, header version), the
+// record format it holds (schema hash and version, record size) and its
+// bookkeeping (live and tombstone counts, free-list head, spare metadata
+// words), and ends in a CRC-32 of the preceding bytes.
+//
+// open() checks the header in O(1): magic, versions, schema hash, record
+// size, checksum, and that the file length equals header + slots. A
+// length off by whole records is a crash between writing a slot and the
+// header (an append whose header never landed); the slots are recounted
+// from the length and the free list rebuilt. A missing or empty file is
+// created with a fresh header; a file without a header (written before
+// headers existed) or with a different schema is refused, and
+// setsail_migrate converts it.
+//
+// Slot i lives at HEADER_SIZE + i * recordSize. All counts are held in
+// memory and written back with writeHeader() after each change.
+//
+// Free slots: release() zero-fills a slot, stores the previous free-list
+// head in it as a little-endian int32 at FREE_LINK_OFFSET, and makes it
+// the new head; insert() pops the head before falling back to appending.
+// Every record type begins with a non-empty text key, so a zero first
+// byte marks a free slot and scans skip it with isLive(). If a link turns
+// out not to point at a free slot (a crash between writing a slot and its
+// header), the list is rebuilt by one scan of the file.
+//
+// Structural rewrites (deletes that move records, bulk removal,
+// migration) never touch the file in place: replaceAll() and
+// replaceFile() write the new contents to PATH.tmp in one sequential
+// stream, sync it, rename it over PATH and sync the directory, so a crash
+// at any point leaves either the old file or the new one. replaceAll()
+// then reopens the same stream object, so references to stream() held
+// by the owner stay valid.
+//
+// Revision History:
+// Rev. 1 - 2025/08/27 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/28 - Team 12
+// - Free-slot list: release() and insert()
+// Rev. 3 - 2025/08/30 - Team 12
+// - crc32 made public for the archive; validate() without a length
+// Rev. 4 - 2025/08/31 - Team 12
+// - replaceAll()/replaceFile() through a synced temporary file;
+//   truncate() removed
+// Rev. 5 - 2025/09/02 - Team 12
+// - open() recovers a length off by whole records; insert() keeps the
+//   counts when its write fails
+// Rev. 6 - 2025/09/02 - Team 12
+// - flush()
+//*******************************
+
+#ifndef RECORD_FILE_H
+#define RECORD_FILE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "schema.h"
+#include "stats.h"
+
+struct FileHeader {
+    char     magic[8];        // "SETSAIL" + NUL
+    uint64_t schemaHash;      // schema::hash<R>() of the record type
+    uint32_t headerVersion;   // layout of this header
+    uint32_t schemaVersion;   // RecordSchema<R>::VERSION
+    uint32_t recordSize;      // bytes per record slot
+    uint32_t liveCount;       // slots holding a record
+    uint32_t tombstoneCount;  // slots freed and not yet reused
+    int32_t  freeHead;        // first free slot, RecordFile::NO_SLOT if none
+    uint32_t meta[5];         // spare words for index roots and owner metadata
+    uint32_t checksum;        // CRC-32 of the bytes before it
+};
+
+template <>
+struct RecordSchema<FileHeader> {
+    static constexpr const char*   NAME    = "header";
+    static constexpr uint32_t      VERSION = 1;
+    static constexpr uint32_t      SIZE    = 64;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(FileHeader, magic,          schema::Type::Text,    0, 8),
+        SCHEMA_FIELD(FileHeader, schemaHash,     schema::Type::UInt64,  8, 8),
+        SCHEMA_FIELD(FileHeader, headerVersion,  schema::Type::UInt32, 16, 4),
+        SCHEMA_FIELD(FileHeader, schemaVersion,  schema::Type::UInt32, 20, 4),
+        SCHEMA_FIELD(FileHeader, recordSize,     schema::Type::UInt32, 24, 4),
+        SCHEMA_FIELD(FileHeader, liveCount,      schema::Type::UInt32, 28, 4),
+        SCHEMA_FIELD(FileHeader, tombstoneCount, schema::Type::UInt32, 32, 4),
+        SCHEMA_FIELD(FileHeader, freeHead,       schema::Type::Int32,  36, 4),
+        SCHEMA_FIELD(FileHeader, meta,           schema::Type::UInt32, 40, 20),
+        SCHEMA_FIELD(FileHeader, checksum,       schema::Type::UInt32, 60, 4),
+    };
+};
+static_assert(schema::layoutMatches<FileHeader>(), "FileHeader does not match the header page");
+
+class RecordFile {
+public:
+    // What a file must hold; build with formatOf<R>()
+    struct Format {
+        const char* name;
+        uint64_t    schemaHash;
+        uint32_t    schemaVersion;
+        uint32_t    recordSize;
+    };
+
+    static constexpr std::streamoff HEADER_SIZE      = RecordSchema<FileHeader>::SIZE;
+    static constexpr uint32_t       HEADER_VERSION   = 1;
+    static constexpr int32_t        NO_SLOT          = -1;
+    static constexpr size_t         FREE_LINK_OFFSET = 4;   // within a free slot
+    static constexpr size_t         WRITE_CHUNK      = 1 << 20;  // bytes per rewrite write
+
+    template <class R>
+    static constexpr Format formatOf() {
+        return Format{ RecordSchema<R>::NAME, schema::hash<R>(),
+                       RecordSchema<R>::VERSION, RecordSchema<R>::SIZE };
+    }
+
+    RecordFile(const char* path, const Format& format);
+
+    //------
+    // Description:
+    // Opens the file for reading and writing, creating it with an empty
+    // header if it is missing or empty, and validates the header. Prints
+    // the reason and returns false if the file cannot be used.
+    // Precondition:
+    // None
+    bool open();
+
+    //------
+    // Description:
+    // Closes the file.
+    // Precondition:
+    // None
+    void close();
+
+    //------
+    // Description:
+    // Discards every record, leaving a file with only a fresh header.
+    // Returns true if successful.
+    // Precondition:
+    // None
+    bool recreate();
+
+    //------
+    // Description:
+    // Replaces the whole file with `records`, in order and with no free
+    // slots, through a synced temporary file, then reopens it. The spare
+    // metadata words are kept. Returns true if successful; on failure the
+    // old file is left as it was.
+    // Precondition:
+    // File must be open; every record's key is non-empty
+    template <class R>
+    bool replaceAll(const std::vector<R>& records) {
+        FileHeader header = freshHeader(recordFormat);
+        std::memcpy(header.meta, hdr.meta, sizeof header.meta);
+        if (!replaceFile(filePath, header, records)) return false;
+        close();
+        return open();
+    }
+
+    //------
+    // Description:
+    // Writes `header` and `records` to PATH.tmp with large sequential
+    // writes, syncs it and renames it over `path`. The header's counts
+    // are set from `records`. Returns true if successful; on failure any
+    // existing file at `path` is left as it was. Used by replaceAll() and
+    // by tools that rewrite data files.
+    // Precondition:
+    // No RecordFile has `path` open for writing
+    template <class R>
+    static bool replaceFile(const std::string& path, FileHeader header,
+                            const std::vector<R>& records) {
+        header.liveCount      = static_cast<uint32_t>(records.size());
+        header.tombstoneCount = 0;
+        header.freeHead       = NO_SLOT;
+        std::ofstream out;
+        if (!beginReplace(path, header, out)) return false;
+
+        constexpr size_t size = RecordSchema<R>::SIZE;
+        std::vector<char> chunk(std::min(records.size(), WRITE_CHUNK / size) * size);
+        for (size_t first = 0; first < records.size(); first += chunk.size() / size) {
+            size_t n = std::min(chunk.size() / size, records.size() - first);
+            for (size_t i = 0; i < n; ++i) schema::encode(records[first + i], chunk.data() + i * size);
+            out.write(chunk.data(), static_cast<std::streamsize>(n * size));
+            STATS_WRITE(n * size);
+        }
+        return finishReplace(path, out);
+    }
+
+    //------
+    // Description:
+    // Writes `rec` into the first free slot, or appends it if there is
+    // none, and writes the header. Sets `slot` to where it went. Returns
+    // true if successful.
+    // Precondition:
+    // File must be open; rec's key is not empty
+    template <class R>
+    bool insert(const R& rec, size_t& slot) {
+        static_assert(RecordSchema<R>::FIELDS[0].type == schema::Type::Text
+                   && RecordSchema<R>::FIELDS[0].offset == 0,
+                      "free slots are marked by an empty leading key");
+        FileHeader before;
+        if (!takeSlot(slot, before)) return false;
+        fileStream.clear();
+        fileStream.seekp(slotOffset(slot), std::ios::beg);
+        if (!schema::writeRecord(fileStream, rec)) {
+            hdr = before;
+            return false;
+        }
+        STATS_WRITE(sizeof rec);
+        return writeHeader();
+    }
+
+    //------
+    // Description:
+    // Frees `slot` for reuse by insert() and writes the header. Returns
+    // true if successful.
+    // Precondition:
+    // File must be open; slot < slotCount() and holds a live record
+    bool release(size_t slot);
+
+    //------
+    // Description:
+    // True if `rec` was read from a slot holding a record rather than a
+    // free one.
+    // Precondition:
+    // None
+    template <class R>
+    static bool isLive(const R& rec) {
+        return reinterpret_cast<const char*>(&rec)[0] != '\0';
+    }
+
+    //------
+    // Description:
+    // Adds `delta` to the live count and writes the header.
+    // Precondition:
+    // File must be open
+    bool addLive(int delta);
+
+    //------
+    // Description:
+    // Writes the in-memory header to the start of the file.
+    // Precondition:
+    // File must be open
+    bool writeHeader();
+
+    //------
+    // Description:
+    // Pushes buffered writes to the file. Returns true if successful or
+    // if the file is not open.
+    // Precondition:
+    // None
+    bool flush();
+
+    //------
+    // Description:
+    // Clears stream errors and positions both get and put at slot 0.
+    // Precondition:
+    // File must be open
+    void rewind();
+
+    bool              isOpen() const { return fileStream.is_open(); }
+    std::fstream&     stream() { return fileStream; }
+    FileHeader&       header() { return hdr; }
+    const std::string& path() const { return filePath; }
+    size_t            liveCount() const { return hdr.liveCount; }
+    size_t            slotCount() const { return size_t(hdr.liveCount) + hdr.tombstoneCount; }
+    std::streamoff    slotOffset(size_t slot) const {
+        return HEADER_SIZE + static_cast<std::streamoff>(slot) * recordFormat.recordSize;
+    }
+    size_t            slotAt(std::streamoff pos) const {
+        return static_cast<size_t>((pos - HEADER_SIZE) / recordFormat.recordSize);
+    }
+
+    //------
+    // Description:
+    // CRC-32 (IEEE) of `n` bytes, as used for header checksums.
+    // Precondition:
+    // None
+    static uint32_t crc32(const char* data, size_t n);
+
+    //------
+    // Description:
+    // Returns an empty header for `format`.
+    // Precondition:
+    // None
+    static FileHeader freshHeader(const Format& format);
+
+    //------
+    // Description:
+    // Computes the header checksum and writes the header at the put
+    // position. Used by tools that write data files directly.
+    // Precondition:
+    // None
+    static bool writeHeader(std::ostream& out, FileHeader& header);
+
+    //------
+    // Description:
+    // Reads a header from the get position. Returns false if the stream
+    // is too short or does not start with the magic.
+    // Precondition:
+    // None
+    static bool readHeader(std::istream& in, FileHeader& header);
+
+    //------
+    // Description:
+    // Checks a header read from a file of `fileSize` bytes against
+    // `format`. Returns an empty string if it is valid, otherwise why not.
+    // A negative fileSize skips the length check, for files that hold
+    // variable-length blocks rather than record slots.
+    // Precondition:
+    // None
+    static std::string validate(const FileHeader& header, const Format& format,
+                                std::streamoff fileSize);
+
+private:
+    // Picks the slot for the next insert and updates the in-memory counts;
+    // `before` gets the header as it was, for insert() to put back
+    bool takeSlot(size_t& slot, FileHeader& before);
+    // Reads the free-list link stored in `slot`; false if it is not free
+    bool readLink(size_t slot, int32_t& next);
+    // Relinks every free slot and recounts live and free slots
+    bool rebuildFreeList();
+    // Opens PATH.tmp and writes `header`; finishReplace() flushes, syncs
+    // and renames it over `path` (removing it on failure)
+    static bool beginReplace(const std::string& path, FileHeader& header, std::ofstream& out);
+    static bool finishReplace(const std::string& path, std::ofstream& out);
+
+    std::string  filePath;
+    Format       recordFormat;
+    FileHeader   hdr;
+    std::fstream fileStream;
+};
+
+#endif // RECORD_FILE_H
@@ -8,15 +8,37 @@
 // Revision History:
 // Rev. 1 - 2025/07/07 - Team 12
 // - Converted to proper class with private member variables
+// Rev. 2 - 2025/08/24 - Team 12
+// - string_view parameters; single-record lookups instead of
+//   per-license vectors
+// Rev. 3 - 2025/08/25 - Team 12
+// - Lane decisions and stored dimensions in whole centimetres
+// Rev. 4 - 2025/09/01 - Team 12
+// - Bookings listed by caller phone number
+// Rev. 5 - 2025/09/02 - Team 12
+// - Rebooking onto another sailing
+// Rev. 6 - 2025/09/02 - Team 12
+// - Bookings that fit no lane move booked vehicles across to make room
+// Rev. 7 - 2025/09/02 - Team 12
+// - A booking whose write fails gives back its lane and lane moves
+// Rev. 8 - 2025/09/02 - Team 12
+// - fromFields/fields
 //*******************************
 
 #include "reservation.h"
 #include "reservation_io.h"
+#include "reassign.h"
+#include "revenue.h"
+#include "stats.h"
+#include "trace.h"
 #include "sailing.h"
 #include "vehicle_io.h"
 #include "vehicle.h"
+#include <iomanip>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 float currentFare = 0.0f;                
 unsigned int currentOccupants = 0;    
@@ -31,7 +53,7 @@ using namespace std;
 // Precondition:
 // None
 bool Reservation::init() {
-    return ReservationIO::open(); 
+    return ReservationIO::open() && RevenueLedger::init();
 }
 
 //------
@@ -40,35 +62,43 @@ bool Reservation::init() {
 // Precondition:
 // Class must be initialized
 void Reservation::shutdown() {
+    RevenueLedger::shutdown();
     ReservationIO::close();
 }
 
 //------
 // Description:
 // Cancels an existing reservation. Returns true if successful.
-bool Reservation::cancelReservation(const std::string& sailingID,
-                                    const std::string& license)
+bool Reservation::cancelReservation(std::string_view sailingID,
+                                    std::string_view license)
 {
-    auto all = ReservationIO::getReservationsByLicense(license);
-    for (const auto& res : all) {
-        if (res.currentSailingID == sailingID) {
-            float length = res.specialVehicleLength > 0.0f
-                               ? res.specialVehicleLength
-                               : 7.0f;
-            if (res.usedHighLane)
-               Sailing::updateSailingForHigh(sailingID, 0, -length);
-             else
-               Sailing::updateSailingForLow(sailingID, 0, -length);
-           // only “undo” occupants if previously checked in
-           if (res.checkedIn) {
-             int   people = static_cast<int>(res.currentPeopleOccupants);
-             Sailing::updateOccupants(sailingID, -people, -length);
-           }
-            break;
-        }
+    STATS_SCOPE(CANCEL_RESERVATION);
+    Trace::recordCancelReservation(sailingID, license);
+    Reservation res;
+    bool found = ReservationIO::findReservation(sailingID, license, res);
+    if (found) {
+        Centimetres length = res.specialVehicleLengthCm > 0
+                                 ? res.specialVehicleLengthCm
+                                 : REGULAR_LENGTH_CM;
+        if (res.usedHighLane)
+           Sailing::updateSailingForHigh(sailingID, 0, -length);
+         else
+           Sailing::updateSailingForLow(sailingID, 0, -length);
+       // only “undo” occupants if previously checked in
+       if (res.checkedIn) {
+         int   people = static_cast<int>(res.currentPeopleOccupants);
+         Sailing::updateOccupants(sailingID, -people, -length);
+       }
     }
     // now remove the record itself
-    return ReservationIO::deleteReservation(sailingID, license);
+    if (!ReservationIO::deleteReservation(sailingID, license)) return false;
+
+    // keep the revenue ledger in step with the file
+    if (found) {
+        RevenueLedger::recordCancellation(sailingID, res.currentFare,
+                                          res.usedHighLane, res.checkedIn);
+    }
+    return true;
 }
 
 
@@ -78,28 +108,28 @@ bool Reservation::cancelReservation(const std::string& sailingID,
 // Precondition:
 // Valid reservation data
 bool Reservation::createReservation(
-    const std::string& sailingID,      // [in] Associated sailing ID
-    const std::string& vehicleLicense, // [in] Vehicle license plate
-    unsigned int occupants,            // [in] Number of people in vehicle
-    const std::string phoneNumber      // [in] Phone Number for reservation
+    std::string_view sailingID,      // [in] Associated sailing ID
+    std::string_view vehicleLicense, // [in] Vehicle license plate
+    unsigned int occupants,          // [in] Number of people in vehicle
+    std::string_view phoneNumber     // [in] Phone Number for reservation
 ) {
+    STATS_SCOPE(CREATE_RESERVATION);
+    Trace::recordCreateReservation(sailingID, vehicleLicense, occupants, phoneNumber);
     
     bool usedHigh = false;
+    Reassignment::LaneMoves moves;
 
-    // standard vehicle length (metres)
-    constexpr float vehicleLength = 7.0f;
+    constexpr Centimetres vehicleLength = REGULAR_LENGTH_CM;
 
     // —— 0) Prevent duplicate reservations for this sailing & vehicle
     {
-        auto existing = ReservationIO::getReservationsByLicense(vehicleLicense);
-        for (const auto& r : existing) {
-            if (r.currentSailingID == sailingID) {
-                std::cout
-                    << "Error: Reservation already exists for sailing "
-                    << sailingID
-                    << " and vehicle “" << vehicleLicense << "”.\n";
-                return false;
-            }
+        Reservation existing;
+        if (ReservationIO::findReservation(sailingID, vehicleLicense, existing)) {
+            std::cout
+                << "Error: Reservation already exists for sailing "
+                << sailingID
+                << " and vehicle “" << vehicleLicense << "”.\n";
+            return false;
         }
     }
 
@@ -128,19 +158,19 @@ bool Reservation::createReservation(
 
     // 4) Try to fit into low-ceiling lane first
     if (Sailing::getLowRemLaneLength(sailingID, vehicleLength)) {
-        Sailing::updateSailingForLow(sailingID, occupants, vehicleLength);
         usedHigh = false;
 
     // 5) Otherwise try high-ceiling lane
     } else if (Sailing::getHighRemLaneLength(sailingID, vehicleLength)) {
-        Sailing::updateSailingForHigh(sailingID, occupants, vehicleLength);
         usedHigh = true;
 
-    // 6) No room anywhere
-    } else {
+    // 6) Otherwise move booked vehicles across lanes to make room
+    } else if (!Reassignment::makeLaneRoom(sailingID, 0, vehicleLength, usedHigh, moves)) {
         std::cout << "No remaining lane space for vehicles.\n";
         return false;
     }
+    if (usedHigh) Sailing::updateSailingForHigh(sailingID, occupants, vehicleLength);
+    else          Sailing::updateSailingForLow(sailingID, occupants, vehicleLength);
 
     
     // 7) Build and persist the reservation record
@@ -149,11 +179,19 @@ bool Reservation::createReservation(
     res.currentVehicleLicense  = vehicleLicense;
     res.currentFare            = 14.0f;  
     res.currentPeopleOccupants       = occupants;
-    res.specialVehicleHeight   = 0.0f;
-    res.specialVehicleLength   = 0.0f;
+    res.specialVehicleHeightCm = 0;
+    res.specialVehicleLengthCm = 0;
     res.usedHighLane = usedHigh;
 
-    return ReservationIO::createReservation(res);
+    // a failed write gives back the lane and any vehicles moved for it
+    if (!ReservationIO::createReservation(res)) {
+        if (usedHigh) Sailing::updateSailingForHigh(sailingID, 0, -vehicleLength);
+        else          Sailing::updateSailingForLow(sailingID, 0, -vehicleLength);
+        Reassignment::undoLaneRoom(sailingID, moves);
+        return false;
+    }
+    RevenueLedger::recordBooking(sailingID, res.currentFare, usedHigh);
+    return true;
 }
 
 //------
@@ -162,24 +200,28 @@ bool Reservation::createReservation(
 // Precondition:
 // Valid reservation data
 bool Reservation::createSpecialReservation(
-    const std::string& sailingID,
-    const std::string& vehicleLicense,
+    std::string_view   sailingID,
+    std::string_view   vehicleLicense,
     unsigned int       occupants,
-    const std::string& phoneNumber,
-    float              height,
-    float              length
+    std::string_view   phoneNumber,
+    float              heightMetres,
+    float              lengthMetres
 ) {
+    STATS_SCOPE(CREATE_SPECIAL_RESERVATION);
+    Trace::recordCreateSpecialReservation(sailingID, vehicleLicense, occupants,
+                                          phoneNumber, heightMetres, lengthMetres);
+    const Centimetres height = toCentimetres(heightMetres);
+    const Centimetres length = toCentimetres(lengthMetres);
+
     // —— 0) Prevent duplicate reservations for this sailing & vehicle
     {
-        auto existing = ReservationIO::getReservationsByLicense(vehicleLicense);
-        for (const auto& r : existing) {
-            if (r.currentSailingID == sailingID) {
-                std::cout
-                    << "Error: Reservation already exists for sailing "
-                    << sailingID
-                    << " and vehicle “" << vehicleLicense << "”.\n";
-                return false;
-            }
+        Reservation existing;
+        if (ReservationIO::findReservation(sailingID, vehicleLicense, existing)) {
+            std::cout
+                << "Error: Reservation already exists for sailing "
+                << sailingID
+                << " and vehicle “" << vehicleLicense << "”.\n";
+            return false;
         }
     }
 
@@ -193,9 +235,9 @@ bool Reservation::createSpecialReservation(
 
     // 2. Register the vehicle if needed
     if (!VehicleIO::checkVehicleExists(vehicleLicense)) {
-        if (height > 2.0f || length > 7.0f)
+        if (height > LOW_LANE_HEIGHT_CM || length > REGULAR_LENGTH_CM)
             Vehicle::createSpecialVehicleForReservation(
-                vehicleLicense, phoneNumber, height, length);
+                vehicleLicense, phoneNumber, heightMetres, lengthMetres);
         else
             Vehicle::createVehicleForReservation(
                 vehicleLicense, phoneNumber);
@@ -203,32 +245,28 @@ bool Reservation::createSpecialReservation(
 
     // 3. Choose lane & compute fare
     bool usedHigh = false;
-    float fare;
+    Reassignment::LaneMoves moves;
     // if it's tall, must go high
-    if (height > 2.0f) {
-        if (!Sailing::getHighRemLaneLength(sailingID, length))
-            return false;
-        Sailing::updateSailingForHigh(sailingID, occupants, length);
+    if (height > LOW_LANE_HEIGHT_CM) {
         usedHigh = true;
-        fare = length * 3.0f;
+        if (!Sailing::getHighRemLaneLength(sailingID, length)
+         && !Reassignment::makeLaneRoom(sailingID, height, length, usedHigh, moves))
+            return false;
 
     } else {
         // first try low
-        if (Sailing::getLowRemLaneLength(sailingID, length)) {
-            Sailing::updateSailingForLow(sailingID, occupants, length);
-            fare = length * 2.0f;
+        if (Sailing::getLowRemLaneLength(sailingID, length))
             usedHigh = false;
-        }
         // otherwise fall back to high
-        else if (Sailing::getHighRemLaneLength(sailingID, length)) {
-            Sailing::updateSailingForHigh(sailingID, occupants, length);
+        else if (Sailing::getHighRemLaneLength(sailingID, length))
             usedHigh = true;
-            fare = length * 3.0f;
-        }
-        else {
+        // otherwise move booked vehicles across lanes
+        else if (!Reassignment::makeLaneRoom(sailingID, height, length, usedHigh, moves))
             return false; // no space anywhere
-        }
     }
+    if (usedHigh) Sailing::updateSailingForHigh(sailingID, occupants, length);
+    else          Sailing::updateSailingForLow(sailingID, occupants, length);
+    const float fare = length * (usedHigh ? 3 : 2) / 100.0f;
 
     // 4. Build and persist the reservation record
     Reservation res;
@@ -236,43 +274,206 @@ bool Reservation::createSpecialReservation(
     res.currentVehicleLicense    = vehicleLicense;
     res.currentFare              = fare;
     res.currentPeopleOccupants   = occupants;
-    res.specialVehicleHeight     = height;
-    res.specialVehicleLength     = length;
+    res.specialVehicleHeightCm   = height;
+    res.specialVehicleLengthCm   = length;
     res.usedHighLane = usedHigh;
 
-    return ReservationIO::createReservation(res);
+    // a failed write gives back the lane and any vehicles moved for it
+    if (!ReservationIO::createReservation(res)) {
+        if (usedHigh) Sailing::updateSailingForHigh(sailingID, 0, -length);
+        else          Sailing::updateSailingForLow(sailingID, 0, -length);
+        Reassignment::undoLaneRoom(sailingID, moves);
+        return false;
+    }
+    RevenueLedger::recordBooking(sailingID, res.currentFare, usedHigh);
+    return true;
 }
 
 
+//------
+// Description:
+// Moves a vehicle's reservation to another sailing. Returns true if
+// successful.
+// Precondition:
+// Reservation must exist and not be checked in
+bool Reservation::rebookReservation(std::string_view license,
+                                    std::string_view fromSailingID,
+                                    std::string_view toSailingID)
+{
+    STATS_SCOPE(REBOOK_RESERVATION);
+    Trace::recordRebookReservation(license, fromSailingID, toSailingID);
+    if (fromSailingID == toSailingID) return false;
+
+    // 1) Every check comes before the first write
+    Reservation res;
+    if (!ReservationIO::findReservation(fromSailingID, license, res)) {
+        std::cout << "No reservation for vehicle “" << license
+                  << "” on sailing " << fromSailingID << ".\n";
+        return false;
+    }
+    if (res.checkedIn) {
+        std::cout << "Vehicle has already checked in for sailing "
+                  << fromSailingID << ".\n";
+        return false;
+    }
+    {
+        Reservation existing;
+        if (ReservationIO::findReservation(toSailingID, license, existing)) {
+            std::cout
+                << "Error: Reservation already exists for sailing "
+                << toSailingID
+                << " and vehicle “" << license << "”.\n";
+            return false;
+        }
+    }
+    if (!Sailing::checkSailingExists(toSailingID)) {
+        std::cout << "Sailing does not exist.\n";
+        return false;
+    }
+    if (!Sailing::checkSailingVehicleCapacity(toSailingID)
+     || !Sailing::checkSailingPeopleCapacity(toSailingID, res.currentPeopleOccupants)) {
+        std::cout << "Sailing " << toSailingID << " does not have room.\n";
+        return false;
+    }
+
+    // 2) Choose the lane as a new booking would: tall vehicles go high,
+    //    everything else low first, moving booked vehicles if neither fits
+    const Centimetres length = res.specialVehicleLengthCm > 0
+                                   ? res.specialVehicleLengthCm
+                                   : REGULAR_LENGTH_CM;
+    bool toHigh;
+    Reassignment::LaneMoves moves;
+    if (res.specialVehicleHeightCm <= LOW_LANE_HEIGHT_CM
+     && Sailing::getLowRemLaneLength(toSailingID, length)) {
+        toHigh = false;
+    } else if (Sailing::getHighRemLaneLength(toSailingID, length)) {
+        toHigh = true;
+    } else if (!Reassignment::makeLaneRoom(toSailingID, res.specialVehicleHeightCm,
+                                           length, toHigh, moves)) {
+        std::cout << "No remaining lane space for vehicles.\n";
+        return false;
+    }
+
+    // 3) Claim the new space, move the record, then free the old space;
+    //    a failed move also puts back any vehicles moved to make room
+    const bool  fromHigh = res.usedHighLane;
+    const float oldFare  = res.currentFare;
+    res.currentSailingID = toSailingID;
+    res.usedHighLane     = toHigh;
+    // special bookings are charged by lane and length, regular ones a flat fare
+    if (res.specialVehicleLengthCm > 0)
+        res.currentFare = length * (toHigh ? 3 : 2) / 100.0f;
+
+    auto adjustLane = [length](std::string_view sailingID, bool high, int sign) {
+        if (high) Sailing::updateSailingForHigh(sailingID, 0, sign * length);
+        else      Sailing::updateSailingForLow(sailingID, 0, sign * length);
+    };
+    adjustLane(toSailingID, toHigh, 1);
+    if (!ReservationIO::moveReservation(fromSailingID, res)) {
+        adjustLane(toSailingID, toHigh, -1);
+        Reassignment::undoLaneRoom(toSailingID, moves);
+        return false;
+    }
+    adjustLane(fromSailingID, fromHigh, -1);
+
+    RevenueLedger::recordCancellation(fromSailingID, oldFare, fromHigh, false);
+    RevenueLedger::recordBooking(toSailingID, res.currentFare, toHigh);
+    return true;
+}
+
 //------
 // Description:
 // Checks in a vehicle for a reservation. Returns true if successful.
 // Precondition:
 // Reservation must exist
 // In reservation.cpp
-bool Reservation::logArrivals(const std::string& sailingID,
-                              const std::string& license)
+bool Reservation::logArrivals(std::string_view sailingID,
+                              std::string_view license)
 {
-    auto reservations = ReservationIO::getReservationsByLicense(license);
-    for (const auto& res : reservations) {
-        if (res.currentSailingID == sailingID && !res.checkedIn) {
-            std::cout << "Vehicle's fare is: $" << res.currentFare << std::endl;
-
-            float length = (res.specialVehicleLength > 0.0f)
-                                 ? res.specialVehicleLength
-                                 : 7.0f;
-
-            // 1) Perform the seating/count update
-            bool ok = Sailing::updateOccupants(sailingID,
-                                               res.currentPeopleOccupants,
-                                               length);
-            if (!ok) return false;
-
-            // 2) Now mark this reservation as checked-in
-            ReservationIO::markCheckedIn(sailingID, license);
-            return true;
-        }
+    STATS_SCOPE(LOG_ARRIVALS);
+    Trace::recordLogArrivals(sailingID, license);
+    Reservation res;
+    if (!ReservationIO::findReservation(sailingID, license, res) || res.checkedIn)
+        return false;
+
+    std::cout << "Vehicle's fare is: $" << res.currentFare << std::endl;
+
+    Centimetres length = (res.specialVehicleLengthCm > 0)
+                               ? res.specialVehicleLengthCm
+                               : REGULAR_LENGTH_CM;
+
+    // 1) Perform the seating/count update
+    bool ok = Sailing::updateOccupants(sailingID,
+                                       res.currentPeopleOccupants,
+                                       length);
+    if (!ok) return false;
+
+    // 2) Now mark this reservation as checked-in
+    if (!ReservationIO::markCheckedIn(sailingID, license)) return false;
+    RevenueLedger::recordCheckIn(sailingID, res.currentFare);
+    return true;
+}
+
+//------
+// Description:
+// Prints every reservation of the vehicles registered to a phone number.
+// Precondition:
+// Class must be initialized
+bool Reservation::printBookingsForPhone(std::string_view phone) {
+    std::vector<Reservation> found;
+    if (!ReservationIO::findReservationsByPhone(phone, found)) return false;
+    std::cout << std::left << std::setw(12) << "License"
+              << std::setw(12) << "SailingID"
+              << std::setw(10) << "Fare"
+              << "Status\n"
+              << std::string(44, '=') << "\n"
+              << std::fixed << std::setprecision(2);
+    for (const Reservation& res : found) {
+        std::cout << std::setw(12) << res.currentVehicleLicense.view()
+                  << std::setw(12) << res.currentSailingID.view()
+                  << std::setw(10) << res.currentFare
+                  << (res.checkedIn ? "checked in" : "booked") << "\n";
     }
-    return false;
+    std::cout << found.size() << " reservation(s)\n";
+    return true;
 }
 
+//------
+// Description:
+// Builds a reservation record from its fields as-is.
+// Precondition:
+// None
+Reservation Reservation::fromFields(const Fields& fields) {
+    Reservation res;
+    res.currentSailingID       = fields.sailingID;
+    res.currentVehicleLicense  = fields.license;
+    res.currentFare            = fields.fare;
+    res.currentPeopleOccupants = fields.occupants;
+    res.currentVehicleLengthCm = fields.vehicleLengthCm;
+    res.phoneNumber            = fields.phone;
+    res.specialVehicleHeightCm = fields.specialHeightCm;
+    res.specialVehicleLengthCm = fields.specialLengthCm;
+    res.usedHighLane           = fields.usedHighLane;
+    res.checkedIn              = fields.checkedIn;
+    return res;
+}
+
+//------
+// Description:
+// Returns this record's fields.
+// Precondition:
+// None
+Reservation::Fields Reservation::fields() const {
+    Fields out;
+    out.sailingID       = currentSailingID.view();
+    out.license         = currentVehicleLicense.view();
+    out.fare            = currentFare;
+    out.occupants       = currentPeopleOccupants;
+    out.vehicleLengthCm = currentVehicleLengthCm;
+    out.phone           = phoneNumber.view();
+    out.specialHeightCm = specialVehicleHeightCm;
+    out.specialLengthCm = specialVehicleLengthCm;
+    out.usedHighLane    = usedHighLane;
+    out.checkedIn       = checkedIn;
+    return out;
+}
@@ -8,19 +8,73 @@
 // Revision History:
 // Rev. 1 - 2025/07/07 - Team 12
 // - Converted to proper class with private member variables
+// Rev. 2 - 2025/08/24 - Team 12
+// - Fixed-capacity keys instead of std::string members, so a Reservation
+//   is trivially copyable and can be written to disk as-is
+// Rev. 3 - 2025/09/01 - Team 12
+// - printBookingsForPhone
+// Rev. 4 - 2025/09/02 - Team 12
+// - rebookReservation
+// Rev. 5 - 2025/09/02 - Team 12
+// - Lane constants public for bulk reassignment
+// Rev. 6 - 2025/09/02 - Team 12
+// - fromFields/fields for tools instead of friend access
 //*******************************
 
 #ifndef RESERVATION_H
 #define RESERVATION_H
 
-#include <string>
+#include <string_view>
+#include "keys.h"
+#include "units.h"
+#include "schema.h"
 
 class Reservation {
     friend class ReservationIO;
     friend class SailingIO;
     friend class VehicleIO;
+    friend class Analytics;
+    friend class RevenueLedger;
+    friend class Reassignment;
+    friend struct RecordSchema<Reservation>;
 
 public:
+    // Standard vehicle length and the tallest vehicle the low lane accepts
+    static constexpr Centimetres REGULAR_LENGTH_CM  = 700;
+    static constexpr Centimetres LOW_LANE_HEIGHT_CM = 200;
+
+    // Every stored field of one reservation, for tools that write or read
+    // records in bulk without going through the booking checks
+    struct Fields {
+        std::string_view sailingID;
+        std::string_view license;
+        float            fare            = 0.0f;
+        unsigned int     occupants       = 0;
+        Centimetres      vehicleLengthCm = 0;
+        std::string_view phone;
+        Centimetres      specialHeightCm = 0;  // 0 for regular vehicles
+        Centimetres      specialLengthCm = 0;  // 0 for regular vehicles
+        bool             usedHighLane    = false;
+        bool             checkedIn       = false;
+    };
+
+    //------
+    // Description:
+    // Builds a reservation record from its fields as-is; keys longer than
+    // their fixed width are truncated. Nothing is checked or written.
+    // Precondition:
+    // None
+    static Reservation fromFields(
+        const Fields& fields  // [in] Values to store
+    );
+
+    //------
+    // Description:
+    // Returns this record's fields. The views point into this record.
+    // Precondition:
+    // None
+    Fields fields() const;
+
     //------
     // Description:
     // Initializes the Reservation class. Returns true if successful.
@@ -41,8 +95,8 @@ public:
     // Precondition:
     // Reservation must exist
     static bool cancelReservation(
-        const std::string& sailingID,  // [in] Sailing ID of reservation
-        const std::string& license     // [in] Vehicle license of reservation
+        std::string_view sailingID,  // [in] Sailing ID of reservation
+        std::string_view license     // [in] Vehicle license of reservation
     );
 
     //------
@@ -51,10 +105,10 @@ public:
     // Precondition:
     // Valid reservation data
     static bool createReservation(
-        const std::string& sailingID,    // [in] Associated sailing ID
-        const std::string& vehicleLicense, // [in] Vehicle license plate
-        unsigned int occupants,           // [in] Number of people in vehicle
-        const std::string phoneNumber     // [in] Phone Number for reservation
+        std::string_view sailingID,      // [in] Associated sailing ID
+        std::string_view vehicleLicense, // [in] Vehicle license plate
+        unsigned int occupants,          // [in] Number of people in vehicle
+        std::string_view phoneNumber     // [in] Phone Number for reservation
     );
 
     //------
@@ -63,33 +117,57 @@ public:
     // Precondition:
     // Valid reservation data
     static bool createSpecialReservation(
-        const std::string& sailingID,    // [in] Associated sailing ID
-        const std::string& vehicleLicense, // [in] Vehicle license plate
+        std::string_view sailingID,      // [in] Associated sailing ID
+        std::string_view vehicleLicense, // [in] Vehicle license plate
         unsigned int occupants,          // [in] Number of people in vehicle
-        const std::string& phoneNumber,     // [in] Phone Number for reservation
+        std::string_view phoneNumber,    // [in] Phone Number for reservation
         float height,                    // [in] Vehicle height in meters
         float length                     // [in] Vehicle length in meters
     );
 
+    //------
+    // Description:
+    // Moves a vehicle's reservation to another sailing, choosing its lane
+    // there as a new booking would. Nothing is changed unless the target
+    // has room, so a failed rebooking keeps the original. Returns true if
+    // successful.
+    // Precondition:
+    // Reservation must exist and not be checked in
+    static bool rebookReservation(
+        std::string_view license,        // [in] Vehicle license of reservation
+        std::string_view fromSailingID,  // [in] Sailing it is booked on
+        std::string_view toSailingID     // [in] Sailing to move it to
+    );
+
     //------
     // Description:
     // Logs vehicle arrivals for a specific sailing.
     // Precondition:
     // Sailing must exist
     static bool logArrivals(
-        const std::string& sailingID,  // [in] Sailing ID of reservation
-        const std::string& license     // [in] Vehicle license of reservation
+        std::string_view sailingID,  // [in] Sailing ID of reservation
+        std::string_view license     // [in] Vehicle license of reservation
+    );
+
+    //------
+    // Description:
+    // Prints every reservation of the vehicles registered to a phone
+    // number. Returns false if no vehicle is registered to it.
+    // Precondition:
+    // Class must be initialized
+    static bool printBookingsForPhone(
+        std::string_view phone  // [in] Caller's phone number
     );
 
 private:
-    std::string currentSailingID;      // Current sailing ID being processed
-    std::string currentVehicleLicense; // Current vehicle license being processed
-    float currentFare;                 // Current fare amount
-    unsigned int currentPeopleOccupants;     // Current number of occupants
-    float currentVehicleLength; // current total length of all vehicles on sailing
-    std::string phoneNumber;     // [in] Phone Number for reservation
-    float specialVehicleHeight;        // Height for special vehicles
-    float specialVehicleLength;       // Length for special vehicles
+    SailingKey currentSailingID;       // Current sailing ID being processed
+    LicenseKey currentVehicleLicense;  // Current vehicle license being processed
+    float currentFare = 0.0f;          // Current fare amount
+    unsigned int currentPeopleOccupants = 0; // Current number of occupants
+    Centimetres currentVehicleLengthCm = 0; // current total length of all vehicles on sailing
+    PhoneNumber phoneNumber;     // [in] Phone Number for reservation
+    Centimetres specialVehicleHeightCm = 0; // Height for special vehicles
+    Centimetres specialVehicleLengthCm = 0; // Length for special vehicles
     bool usedHighLane = false;   // true if this reservation went into the high-ceiling lane
     bool checkedIn = false;         // true if the vehicle has been logged as arrived/checkedIn
 };
@@ -8,36 +8,220 @@
 // Revision History:
 // Rev. 1 - 2025/07/07 - Team 12
 // - Converted to class format with all file I/O operations
+// Rev. 2 - 2025/08/26 - Team 12
+// - Records read and written through RecordSchema
+// Rev. 3 - 2025/08/27 - Team 12
+// - Versioned file header (RecordFile)
+// Rev. 4 - 2025/08/28 - Team 12
+// - Deletes free their slot in place; creates reuse freed slots
+// Rev. 5 - 2025/08/29 - Team 12
+// - One shard file per departure day
+// Rev. 6 - 2025/08/30 - Team 12
+// - readShard
+// Rev. 7 - 2025/08/31 - Team 12
+// - Scans read each shard in blocks (RecordScanner)
+// Rev. 8 - 2025/09/01 - Team 12
+// - License index; lookups by license and by phone
+// Rev. 9 - 2025/09/02 - Team 12
+// - moveReservation; sailing and license lookups use the license index
+//   once it is built
+// Rev. 10 - 2025/09/02 - Team 12
+// - readReservationsForSailing; replaceSailingReservations
+// Rev. 11 - 2025/09/02 - Team 12
+// - updateReservations
+// Rev. 12 - 2025/09/02 - Team 12
+// - flush
+// Rev. 13 - 2025/09/02 - Team 12
+// - findOpenBooking; dropShard and archiveShard refuse shards with
+//   bookings not checked in
 //*******************************
 
 #include "reservation_io.h"
 #include "reservation.h"
+#include "sailing.h"
 #include "vehicle.h"
+#include "vehicle_io.h"
+#include "stats.h"
+#include "record_file.h"
+#include "record_block.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <unordered_map>
 
-static std::fstream dataFile;
-static const std::string fileName = "reservations.dat"; // changed from currentFileName to fileName
+// Written before reservations were sharded; setsail_migrate splits it
+static const char* const UNSHARDED_FILE = "reservations.dat";
+
+// Shard files by day, created on first use. A shard that has never been
+// written to has no file and is skipped by every scan.
+static std::unique_ptr<RecordFile> shards[ReservationIO::SHARD_COUNT];
 static bool isOpen = false;
 
+// Where a reservation lives
+struct Location {
+    int    shard;
+    size_t slot;
+    bool operator<(const Location& o) const {
+        return shard != o.shard ? shard < o.shard : slot < o.slot;
+    }
+    bool operator==(const Location& o) const { return shard == o.shard && slot == o.slot; }
+};
+
+// Locations of each license's reservations in file order (shard, then
+// slot). Built by one scan on the first lookup by license, kept in step
+// with creates and deletes, and dropped when a shard is retired.
+static std::unordered_map<LicenseKey, std::vector<Location>> licenseIndex;
+static bool licenseIndexBuilt = false;
+
+static void addLocation(const LicenseKey& license, Location at) {
+    std::vector<Location>& list = licenseIndex[license];
+    list.insert(std::lower_bound(list.begin(), list.end(), at), at);
+}
+
+static void removeLocation(const LicenseKey& license, Location at) {
+    auto it = licenseIndex.find(license);
+    if (it == licenseIndex.end()) return;
+    std::vector<Location>& list = it->second;
+    list.erase(std::remove(list.begin(), list.end(), at), list.end());
+    if (list.empty()) licenseIndex.erase(it);
+}
+
+static void dropLicenseIndex() {
+    licenseIndex.clear();
+    licenseIndexBuilt = false;
+}
+
+// Reads the record in `slot` of `file` into `out`.
+static bool readSlot(RecordFile& file, size_t slot, Reservation& out) {
+    std::fstream& in = file.stream();
+    in.clear();
+    in.seekg(file.slotOffset(slot));
+    if (!schema::readRecord(in, out)) return false;
+    STATS_READ(sizeof out);
+    return true;
+}
+
+// Writes `res` over the record in `slot` of `file`.
+static bool writeSlot(RecordFile& file, size_t slot, const Reservation& res) {
+    std::fstream& out = file.stream();
+    out.clear();
+    out.seekp(file.slotOffset(slot));
+    schema::writeRecord(out, res);
+    STATS_WRITE(sizeof res);
+    out.flush();
+    STATS_FLUSH();
+    return static_cast<bool>(out);
+}
+
+// The RecordFile for `shard`, constructed (not opened) on first use.
+static RecordFile& shardFile(int shard) {
+    if (!shards[shard]) {
+        std::string path = ReservationIO::shardPath(shard);
+        shards[shard] = std::make_unique<RecordFile>(path.c_str(),
+                                                     RecordFile::formatOf<Reservation>());
+    }
+    return *shards[shard];
+}
+
+// Opens `shard`, creating its file only if `create` is set. Returns
+// nullptr if it has no file (and none was wanted) or cannot be opened.
+static RecordFile* openShard(int shard, bool create) {
+    RecordFile& file = shardFile(shard);
+    if (file.isOpen()) return &file;
+    if (!create && !std::filesystem::exists(file.path())) return nullptr;
+    return file.open() ? &file : nullptr;
+}
+
+// The open shard holding `sailingID`'s reservations, or nullptr if it has none.
+static RecordFile* shardFor(std::string_view sailingID, bool create = false) {
+    if (!isOpen) return nullptr;
+    return openShard(ReservationIO::shardOf(sailingID), create);
+}
+
+// Appends every live reservation in `file` to `out`, a block at a time.
+static void appendLive(RecordFile& file, std::vector<Reservation>& out) {
+    RecordScanner<Reservation> scan(file);
+    while (scan.nextBlock()) {
+        for (const Reservation& res : scan)
+            if (RecordFile::isLive(res)) out.push_back(res);
+    }
+}
+
+bool ReservationIO::findInShard(RecordFile& file, std::string_view sailingID,
+                                std::string_view license, Reservation& out, size_t& slot) {
+    RecordScanner<Reservation> scan(file);
+    while (scan.nextBlock()) {
+        for (size_t i = 0; i < scan.size(); ++i) {
+            const Reservation& r = scan[i];
+            if (RecordFile::isLive(r)
+             && r.currentSailingID == sailingID
+             && r.currentVehicleLicense == license) {
+                out  = r;
+                slot = scan.firstSlot() + i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool ReservationIO::locate(RecordFile& file, std::string_view sailingID,
+                           std::string_view license, Reservation& out, size_t& slot) {
+    if (!licenseIndexBuilt) return findInShard(file, sailingID, license, out, slot);
+    auto it = licenseIndex.find(LicenseKey(license));
+    if (it == licenseIndex.end()) return false;
+    int shard = shardOf(sailingID);
+    for (const Location& at : it->second) {
+        if (at.shard != shard) continue;
+        if (!readSlot(file, at.slot, out)) return false;
+        if (out.currentSailingID == sailingID && out.currentVehicleLicense == license) {
+            slot = at.slot;
+            return true;
+        }
+    }
+    return false;
+}
+
+int ReservationIO::shardOf(std::string_view sailingID) {
+    std::string terminal;
+    int day, hour;
+    if (!Sailing::parseSailingID(sailingID, terminal, day, hour)
+     || day < 1 || day >= SHARD_COUNT)
+        return 0;
+    return day;
+}
+
+std::string ReservationIO::shardPath(int shard) {
+    char name[32];
+    std::snprintf(name, sizeof name, "reservations-%02d.dat", shard);
+    return name;
+}
+
 //------
 // Description:
 // Opens the reservation data file. Returns true if successful.
 // Precondition:
 // None
 bool ReservationIO::open() {
-    if (!isOpen) {
-        dataFile.open(fileName, std::ios::in | std::ios::out | std::ios::binary);
-
-        if (!dataFile.is_open()) {
-            dataFile.open(fileName, std::ios::out | std::ios::binary); 
-            dataFile.close();
-            dataFile.open(fileName, std::ios::in | std::ios::out | std::ios::binary);
+    if (isOpen) return true;
+    if (std::filesystem::exists(UNSHARDED_FILE)) {
+        std::cerr << "Error: " << UNSHARDED_FILE
+                  << " predates per-day shards (run setsail_migrate)\n";
+        return false;
+    }
+    // validate every existing shard up front, as a single file was
+    for (int shard = 0; shard < SHARD_COUNT; ++shard) {
+        if (std::filesystem::exists(shardPath(shard)) && !openShard(shard, false)) {
+            for (auto& file : shards) if (file) file->close();
+            return false;
         }
-        
-        isOpen = dataFile.is_open();
     }
-    return isOpen;
+    isOpen = true;
+    reset();
+    return true;
 }
 
 //------
@@ -47,21 +231,30 @@ bool ReservationIO::open() {
 // File must be open
 void ReservationIO::close() {
     if (isOpen) {
-        dataFile.close();
+        dropLicenseIndex();
+        for (auto& file : shards) if (file) file->close();
         isOpen = false;
     }
 }
 
 //------
 // Description:
-// Resets the file iterator to beginning of file.
+// Pushes buffered writes to every open shard.
+// Precondition:
+// None
+bool ReservationIO::flush() {
+    bool ok = true;
+    for (auto& file : shards) if (file) ok = file->flush() && ok;
+    return ok;
+}
+
+//------
+// Description:
+// Rewinds every open shard to its first record.
 // Precondition:
 // File must be open
 void ReservationIO::reset() {
-    if (isOpen) {
-        dataFile.clear();
-        dataFile.seekg(0, std::ios::beg);
-    }
+    for (auto& file : shards) if (file && file->isOpen()) file->rewind();
 }
 
 //------
@@ -70,109 +263,354 @@ void ReservationIO::reset() {
 // Precondition:
 // Valid reservation data
 bool ReservationIO::createReservation( const Reservation& res) {
-    if (!isOpen) return false;
-    dataFile.clear();
-    dataFile.seekp(0, std::ios::end);
-
-    dataFile.write(reinterpret_cast<const char*>(&res), sizeof(Reservation));
-    return dataFile.good();
-} 
+    STATS_SCOPE(RESERVATION_IO_CREATE);
+    RecordFile* file = shardFor(res.currentSailingID.view(), true);
+    if (!file) return false;
+    size_t slot;
+    if (!file->insert(res, slot)) return false;
+    if (licenseIndexBuilt)
+        addLocation(res.currentVehicleLicense, { shardOf(res.currentSailingID.view()), slot });
+    return true;
+}
 
 //------
 // Description:
 // Deletes a reservation record. Returns true if successful, false if reservationd doesn't exist
-bool ReservationIO::deleteReservation(const std::string& sailingID,
-                                       const std::string& license)
+bool ReservationIO::deleteReservation(std::string_view sailingID,
+                                      std::string_view license)
 {
-    if (!isOpen) return false;
+    STATS_SCOPE(RESERVATION_IO_DELETE);
+    RecordFile* file = shardFor(sailingID);
+    Reservation temp;
+    size_t slot;
+    if (!file || !locate(*file, sailingID, license, temp, slot)) return false;
 
-    std::vector<Reservation> allReservations;
-    bool found = false;
+    // free the slot in place; the next create reuses it
+    bool ok = file->release(slot) && file->stream().flush();
+    STATS_FLUSH();
+    if (licenseIndexBuilt) removeLocation(temp.currentVehicleLicense, { shardOf(sailingID), slot });
+    return ok;
+}
 
-    reset();
+bool ReservationIO::markCheckedIn(std::string_view sailingID,
+                                  std::string_view license)
+{
+    STATS_SCOPE(RESERVATION_IO_UPDATE);
+    RecordFile* file = shardFor(sailingID);
     Reservation temp;
-    while (dataFile.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        // if this record matches the one to delete, skip it and mark "found"
-        if (temp.currentSailingID == sailingID
-         && temp.currentVehicleLicense == license) {
-            found = true;
-            continue;
-        }
-        allReservations.push_back(temp);
+    size_t slot;
+    if (!file || !locate(*file, sailingID, license, temp, slot)) return false;
+
+    temp.checkedIn = true;
+    return writeSlot(*file, slot, temp);
+}
+
+bool ReservationIO::moveReservation(std::string_view fromSailingID,
+                                    const Reservation& res)
+{
+    STATS_SCOPE(RESERVATION_IO_UPDATE);
+    std::string_view license = res.currentVehicleLicense.view();
+    RecordFile* from = shardFor(fromSailingID);
+    if (!from) return false;
+    if (!licenseIndexBuilt) buildLicenseIndex();
+    Reservation old;
+    size_t slot;
+    if (!locate(*from, fromSailingID, license, old, slot)) return false;
+
+    int fromShard = shardOf(fromSailingID);
+    int toShard   = shardOf(res.currentSailingID.view());
+    if (toShard == fromShard) return writeSlot(*from, slot, res);
+
+    // write the new record first, so a failure leaves the old one booked
+    RecordFile* to = shardFor(res.currentSailingID.view(), true);
+    size_t newSlot;
+    if (!to || !to->insert(res, newSlot)) return false;
+    if (!from->release(slot) || !from->stream().flush()) {
+        to->release(newSlot);
+        return false;
     }
+    STATS_FLUSH();
+    removeLocation(res.currentVehicleLicense, { fromShard, slot });
+    addLocation(res.currentVehicleLicense, { toShard, newSlot });
+    return true;
+}
+
 
-    if (!found) return false;
+//------
+// Description:
+// Copies the reservation for a sailing and license into `out`.
+// Precondition:
+// File must be open
+bool ReservationIO::findReservation(std::string_view sailingID,
+                                    std::string_view license,
+                                    Reservation& out)
+{
+    STATS_SCOPE(RESERVATION_IO_LOOKUP);
+    RecordFile* file = shardFor(sailingID);
+    size_t slot;
+    return file && locate(*file, sailingID, license, out, slot);
+}
 
-    // rewrite file without the deleted record
-    dataFile.close();
-    isOpen = false;
+bool ReservationIO::hasReservationsForSailing(std::string_view sailingID) {
+    STATS_SCOPE(RESERVATION_IO_LOOKUP);
+    RecordFile* file = shardFor(sailingID);
+    if (!file) return false;
+    RecordScanner<Reservation> scan(*file);
+    while (scan.nextBlock()) {
+        for (const Reservation& temp : scan) {
+            if (RecordFile::isLive(temp) && temp.currentSailingID == sailingID) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
 
-    // reopen in read/write mode, truncating
-    dataFile.open(fileName,
-                  std::ios::in | std::ios::out    // << add input mode
-                | std::ios::trunc | std::ios::binary);
-    isOpen = dataFile.is_open();
+bool ReservationIO::readReservationsForSailing(std::string_view sailingID,
+                                               std::vector<Reservation>& out)
+{
+    STATS_SCOPE(RESERVATION_IO_LOOKUP);
+    out.clear();
+    if (!isOpen) return false;
+    RecordFile* file = shardFor(sailingID);
+    if (!file) return true;
+    RecordScanner<Reservation> scan(*file);
+    while (scan.nextBlock()) {
+        for (const Reservation& res : scan)
+            if (RecordFile::isLive(res) && res.currentSailingID == sailingID)
+                out.push_back(res);
+    }
+    return true;
+}
 
+bool ReservationIO::replaceSailingReservations(std::string_view sailingID,
+                                               const std::vector<Reservation>& moved)
+{
+    STATS_SCOPE(RESERVATION_IO_UPDATE);
     if (!isOpen) return false;
+    const int fromShard = shardOf(sailingID);
 
-    for (const auto& r : allReservations) {
-        dataFile.write(reinterpret_cast<const char*>(&r), sizeof r);
+    // 1) The sailing's slots, in one pass over its shard
+    struct Old { size_t slot; LicenseKey license; };
+    std::vector<Old> old;
+    RecordFile* from = shardFor(sailingID);
+    if (from) {
+        RecordScanner<Reservation> scan(*from);
+        while (scan.nextBlock()) {
+            for (size_t i = 0; i < scan.size(); ++i)
+                if (RecordFile::isLive(scan[i]) && scan[i].currentSailingID == sailingID)
+                    old.push_back({ scan.firstSlot() + i, scan[i].currentVehicleLicense });
+        }
     }
-    dataFile.flush();
 
-    // reposition for future reads
-    dataFile.clear();
-    dataFile.seekg(0, std::ios::beg);
+    // 2) Write the replacements and flush each shard they went to once,
+    //    undoing them if one fails
+    std::vector<Location> written;
+    written.reserve(moved.size());
+    bool touched[SHARD_COUNT] = {};
+    bool ok = true;
+    for (const Reservation& res : moved) {
+        int         shard = shardOf(res.currentSailingID.view());
+        RecordFile* to    = openShard(shard, true);
+        size_t      slot;
+        if (!to || !to->insert(res, slot)) { ok = false; break; }
+        written.push_back({ shard, slot });
+        touched[shard] = true;
+    }
+    for (int s = 0; s < SHARD_COUNT && ok; ++s)
+        if (touched[s]) ok = static_cast<bool>(shards[s]->stream().flush());
+    STATS_FLUSH();
+    if (!ok) {
+        for (const Location& at : written) shards[at.shard]->release(at.slot);
+        for (int s = 0; s < SHARD_COUNT; ++s) if (touched[s]) shards[s]->stream().flush();
+        return false;
+    }
+    if (licenseIndexBuilt)
+        for (size_t i = 0; i < moved.size(); ++i)
+            addLocation(moved[i].currentVehicleLicense, written[i]);
 
-    return dataFile.good();
+    // 3) The batch is committed; free the old slots. One that cannot be
+    //    freed stays on the sailing as a stale copy, which keeps the
+    //    sailing from being deleted until it is cancelled by hand.
+    size_t stale = 0;
+    for (const Old& o : old) {
+        if (!from->release(o.slot)) { ++stale; continue; }
+        if (licenseIndexBuilt) removeLocation(o.license, { fromShard, o.slot });
+    }
+    if (from && !from->stream().flush()) stale = old.size();
+    STATS_FLUSH();
+    if (stale > 0)
+        std::cerr << "Warning: " << stale << " old reservation(s) of " << sailingID
+                  << " could not be removed\n";
+    return true;
 }
 
-bool ReservationIO::markCheckedIn(const std::string& sailingID,
-                                  const std::string& license)
+bool ReservationIO::updateReservations(std::string_view sailingID,
+                                       const std::vector<Reservation>& changed)
 {
-    reset();
-    Reservation temp;
-    std::streamoff pos;
-    while ((pos = dataFile.tellg()), dataFile.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (temp.currentSailingID == sailingID
-         && temp.currentVehicleLicense == license) {
-            temp.checkedIn = true;
-            dataFile.clear();
-            dataFile.seekp(pos);
-            dataFile.write(reinterpret_cast<const char*>(&temp), sizeof temp);
-            dataFile.flush();
-            return true;
+    STATS_SCOPE(RESERVATION_IO_UPDATE);
+    if (changed.empty()) return true;
+    RecordFile* file = shardFor(sailingID);
+    if (!file) return false;
+
+    std::unordered_map<LicenseKey, const Reservation*> byLicense;
+    for (const Reservation& res : changed) byLicense[res.currentVehicleLicense] = &res;
+
+    // Collect the slots first: writing while the scanner holds a block
+    // would leave that block stale
+    std::vector<std::pair<size_t, const Reservation*>> writes;
+    RecordScanner<Reservation> scan(*file);
+    while (scan.nextBlock()) {
+        for (size_t i = 0; i < scan.size(); ++i) {
+            const Reservation& r = scan[i];
+            if (!RecordFile::isLive(r) || r.currentSailingID != sailingID) continue;
+            auto it = byLicense.find(r.currentVehicleLicense);
+            if (it != byLicense.end()) writes.push_back({ scan.firstSlot() + i, it->second });
         }
     }
-    return false;
-}
 
+    std::fstream& out = file->stream();
+    for (const auto& w : writes) {
+        out.clear();
+        out.seekp(file->slotOffset(w.first));
+        schema::writeRecord(out, *w.second);
+        STATS_WRITE(sizeof *w.second);
+    }
+    out.flush();
+    STATS_FLUSH();
+    return out && writes.size() == changed.size();
+}
 
 //------
 // Description:
-// Gets all reservations for a license plate. Returns vector of reservations.
+// Reads every reservation record into `out` in one sequential pass.
 // Precondition:
 // File must be open
-std::vector<Reservation> ReservationIO::getReservationsByLicense(const std::string& license) {
-    std::vector<Reservation> matches;
-    if (!isOpen) return matches;
-    reset();
-    Reservation temp;
-    while (dataFile.read(reinterpret_cast<char*>(&temp), sizeof(Reservation))) {
-        if (temp.currentVehicleLicense == license) {
-            matches.push_back(temp);
+bool ReservationIO::readAllReservations(std::vector<Reservation>& out) {
+    STATS_SCOPE(RESERVATION_IO_READ_ALL);
+    out.clear();
+    if (!isOpen) return false;
+
+    size_t live = 0;
+    for (auto& file : shards) if (file && file->isOpen()) live += file->liveCount();
+    out.reserve(live);
+
+    for (auto& file : shards)
+        if (file && file->isOpen()) appendLive(*file, out);
+    return true;
+}
+
+bool ReservationIO::readShard(int shard, std::vector<Reservation>& out) {
+    STATS_SCOPE(RESERVATION_IO_READ_ALL);
+    out.clear();
+    if (!isOpen || shard < 0 || shard >= SHARD_COUNT) return false;
+    RecordFile* file = openShard(shard, false);
+    if (!file) return !std::filesystem::exists(shardPath(shard));
+    out.reserve(file->liveCount());
+    appendLive(*file, out);
+    return true;
+}
+
+bool ReservationIO::findOpenBooking(int shard, std::string& sailingID) {
+    RecordFile* file = openShard(shard, false);
+    if (!file) return false;
+    RecordScanner<Reservation> scan(*file);
+    while (scan.nextBlock()) {
+        for (size_t i = 0; i < scan.size(); ++i) {
+            if (RecordFile::isLive(scan[i]) && !scan[i].checkedIn) {
+                sailingID = std::string(scan[i].currentSailingID.view());
+                return true;
+            }
         }
     }
-    return matches;
+    return false;
+}
+
+// Closes a shard and either deletes its file or moves it into `dir`.
+// Refuses while any reservation in it is not checked in: the shard of an
+// earlier day may already hold next month's bookings.
+static bool retireShard(int shard, const std::filesystem::path* dir) {
+    if (shard < 0 || shard >= ReservationIO::SHARD_COUNT) return false;
+    RecordFile& file = shardFile(shard);
+    std::string booked;
+    if (ReservationIO::findOpenBooking(shard, booked)) {
+        std::cerr << "Error: cannot " << (dir ? "archive " : "drop ") << file.path()
+                  << ": " << booked << " has bookings not checked in\n";
+        return false;
+    }
+    file.close();
+    dropLicenseIndex();
+    std::error_code ec;
+    if (!std::filesystem::exists(file.path(), ec)) return !ec;
+    if (dir) std::filesystem::rename(file.path(), *dir / file.path(), ec);
+    else     std::filesystem::remove(file.path(), ec);
+    if (ec) {
+        std::cerr << "Error: cannot " << (dir ? "archive " : "drop ")
+                  << file.path() << ": " << ec.message() << "\n";
+        return false;
+    }
+    return true;
 }
 
-bool ReservationIO::hasReservationsForSailing(const std::string& sailingID) {
-    reset();
-    Reservation temp;
-    while (dataFile.read(reinterpret_cast<char*>(&temp), sizeof(temp))) {
-        if (temp.currentSailingID == sailingID) {
-            return true;
+bool ReservationIO::dropShard(int shard) {
+    return retireShard(shard, nullptr);
+}
+
+bool ReservationIO::archiveShard(int shard, std::string_view dir) {
+    std::filesystem::path target(dir);
+    return retireShard(shard, &target);
+}
+
+void ReservationIO::buildLicenseIndex() {
+    licenseIndex.clear();
+    for (int shard = 0; shard < SHARD_COUNT; ++shard) {
+        if (!shards[shard] || !shards[shard]->isOpen()) continue;
+        RecordScanner<Reservation> scan(*shards[shard]);
+        while (scan.nextBlock()) {
+            for (size_t i = 0; i < scan.size(); ++i)
+                if (RecordFile::isLive(scan[i]))
+                    addLocation(scan[i].currentVehicleLicense, { shard, scan.firstSlot() + i });
         }
     }
-    return false;
-}
\ No newline at end of file
+    licenseIndexBuilt = true;
+}
+
+bool ReservationIO::visitLicense(std::string_view license,
+                                 bool (*visit)(void* target, const Reservation& res),
+                                 void* target)
+{
+    if (!isOpen || license.empty()) return false;
+    if (!licenseIndexBuilt) buildLicenseIndex();
+    auto it = licenseIndex.find(LicenseKey(license));
+    if (it == licenseIndex.end()) return true;
+    Reservation temp;
+    for (const Location& at : it->second) {
+        if (!readSlot(*shards[at.shard], at.slot, temp)) return false;
+        // an over-long probe shares a key with the license it truncates to
+        if (temp.currentVehicleLicense == license && !visit(target, temp)) break;
+    }
+    return true;
+}
+
+bool ReservationIO::readReservationsForLicense(std::string_view license,
+                                               std::vector<Reservation>& out)
+{
+    return visitLicense(license,
+                        [](void* target, const Reservation& res) {
+                            static_cast<std::vector<Reservation>*>(target)->push_back(res);
+                            return true;
+                        },
+                        &out);
+}
+
+bool ReservationIO::findReservationsByPhone(std::string_view phone,
+                                            std::vector<Reservation>& out)
+{
+    STATS_SCOPE(RESERVATION_IO_LOOKUP);
+    out.clear();
+    std::vector<LicenseKey> licenses;
+    if (!isOpen || !VehicleIO::findLicensesByPhone(phone, licenses)) return false;
+    for (const LicenseKey& license : licenses)
+        if (!readReservationsForLicense(license.view(), out)) return false;
+    return true;
+}
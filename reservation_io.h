@@ -5,16 +5,101 @@
 // This class handles all file input/output operations for Reservation records,
 // providing persistent storage for reservation data.
 //
+// Reservations are stored in one shard file per departure day,
+// reservations-DD.dat, DD being the day field of the sailing ID
+// (TER-DD-HH); shard 00 holds IDs without a valid day. The sailing ID
+// is its own directory entry, so operations on one sailing open and
+// scan only its day's shard, while license lookups and full reads walk
+// every shard in day order. A day whose bookings are all checked in can
+// be dropped or archived by removing or moving its one file.
+//
 // Revision History:
 // Rev. 1 - 2025/07/07 - Team 12
 // - Converted to class format with all file I/O operations
+// Rev. 2 - 2025/08/24 - Team 12
+// - string_view keys; findReservation and a visitor replace the
+//   vector-returning license lookup
+// Rev. 3 - 2025/08/29 - Team 12
+// - Per-day shard files; dropShard and archiveShard
+// Rev. 4 - 2025/08/30 - Team 12
+// - readShard for the archive
+// Rev. 5 - 2025/08/31 - Team 12
+// - findInShard; scans read in blocks
+// Rev. 6 - 2025/09/01 - Team 12
+// - License index behind forEachReservationForLicense;
+//   findReservationsByPhone
+// Rev. 7 - 2025/09/02 - Team 12
+// - moveReservation; lookups through the license index once built
+// Rev. 8 - 2025/09/02 - Team 12
+// - readReservationsForSailing and replaceSailingReservations
+// Rev. 9 - 2025/09/02 - Team 12
+// - updateReservations
+// Rev. 10 - 2025/09/02 - Team 12
+// - forEachReservationForLicense reads each indexed slot straight into
+//   the visitor again, without collecting them first
+// Rev. 11 - 2025/09/02 - Team 12
+// - replaceSailingReservations commits once the replacements are flushed
+// Rev. 12 - 2025/09/02 - Team 12
+// - flush
+// Rev. 13 - 2025/09/02 - Team 12
+// - findOpenBooking; dropShard and archiveShard refuse shards with
+//   bookings not checked in
 //*******************************
 
+#ifndef RESERVATION_IO_H
+#define RESERVATION_IO_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include "reservation.h"
+#include "stats.h"
+#include "schema.h"
+
+class RecordFile;
+
+template <>
+struct RecordSchema<Reservation> {
+    static constexpr const char*   NAME    = "reservation";
+    static constexpr uint32_t      VERSION = 2;
+    static constexpr uint32_t      SIZE    = 104;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(Reservation, currentSailingID,       schema::Type::Text,     0, 32),
+        SCHEMA_FIELD(Reservation, currentVehicleLicense,  schema::Type::Text,    32, 32),
+        SCHEMA_FIELD(Reservation, currentFare,            schema::Type::Float32, 64, 4),
+        SCHEMA_FIELD(Reservation, currentPeopleOccupants, schema::Type::UInt32,  68, 4),
+        SCHEMA_FIELD(Reservation, currentVehicleLengthCm, schema::Type::Int32,   72, 4),
+        SCHEMA_FIELD(Reservation, phoneNumber,            schema::Type::Text,    76, 15),
+        SCHEMA_FIELD(Reservation, specialVehicleHeightCm, schema::Type::Int32,   92, 4),
+        SCHEMA_FIELD(Reservation, specialVehicleLengthCm, schema::Type::Int32,   96, 4),
+        SCHEMA_FIELD(Reservation, usedHighLane,           schema::Type::Bool,   100, 1),
+        SCHEMA_FIELD(Reservation, checkedIn,              schema::Type::Bool,   101, 1),
+    };
+};
+static_assert(schema::layoutMatches<Reservation>(), "Reservation does not match reservations.dat");
 
 class ReservationIO {
 public:
+    // Shard 0 plus one per day of the month
+    static const int SHARD_COUNT = 32;
+
+    //------
+    // Description:
+    // Returns the shard holding reservations for `sailingID`: its day of
+    // departure (1-31), or 0 if the ID has no valid day.
+    // Precondition:
+    // None
+    static int shardOf(std::string_view sailingID);
+
+    //------
+    // Description:
+    // Returns the file name of a shard, e.g. "reservations-07.dat".
+    // Precondition:
+    // 0 <= shard < SHARD_COUNT
+    static std::string shardPath(int shard);
+
     //------
     // Description:
     // Opens the reservation data file. Returns true if successful.
@@ -31,7 +116,15 @@ public:
 
     //------
     // Description:
-    // Resets the file iterator to beginning of file.
+    // Pushes buffered writes to every open shard. Returns true if
+    // successful.
+    // Precondition:
+    // None
+    static bool flush();
+
+    //------
+    // Description:
+    // Rewinds every open shard to its first record.
     // Precondition:
     // File must be open
     static void reset();
@@ -51,30 +144,199 @@ public:
     // Precondition:
     // File must be open
     static bool deleteReservation(
-        const std::string& sailingID,  // [in] Sailing ID of reservation
-        const std::string& license     // [in] Vehicle license of reservation
+        std::string_view sailingID,  // [in] Sailing ID of reservation
+        std::string_view license     // [in] Vehicle license of reservation
     );
 
     // marks a reservation record as checked in. 
-    static bool markCheckedIn(const std::string& sailingID,
-                                  const std::string& license);
+    static bool markCheckedIn(std::string_view sailingID,
+                              std::string_view license);
 
     //------
     // Description:
-    // Gets all reservations for a license plate. Returns vector of reservations.
+    // Moves the reservation of `res`'s license on `fromSailingID` to the
+    // sailing, lane and fare in `res`. The record is rewritten in place if
+    // both sailings share a shard; otherwise `res` is written to its shard
+    // before the old slot is freed. Returns false, leaving the old record
+    // as it was, if there is no such reservation or the write fails.
     // Precondition:
     // File must be open
-    static std::vector<Reservation> getReservationsByLicense(
-        const std::string& license  // [in] Vehicle license to search
+    static bool moveReservation(
+        std::string_view fromSailingID,  // [in] Sailing ID it is booked on
+        const Reservation& res           // [in] The reservation as moved
+    );
+
+    //------
+    // Description:
+    // Copies the reservation for a sailing and license into `out`.
+    // Returns false if there is none.
+    // Precondition:
+    // File must be open
+    static bool findReservation(
+        std::string_view sailingID,  // [in] Sailing ID of reservation
+        std::string_view license,    // [in] Vehicle license of reservation
+        Reservation& out             // [out] Matching reservation
+    );
+
+    //------
+    // Description:
+    // Calls `visit(const Reservation&)` for every reservation of a license
+    // plate, in file order, until it returns false.
+    // Precondition:
+    // File must be open
+    template <typename Visitor>
+    static void forEachReservationForLicense(
+        std::string_view license,  // [in] Vehicle license to search
+        Visitor&& visit            // [in] Callback; return false to stop
+    ) {
+        STATS_SCOPE(RESERVATION_IO_LOOKUP);
+        using Target = std::remove_reference_t<Visitor>;
+        visitLicense(license,
+                     [](void* target, const Reservation& res) {
+                         return static_cast<bool>((*static_cast<Target*>(target))(res));
+                     },
+                     const_cast<void*>(static_cast<const void*>(std::addressof(visit))));
+    }
+
+    //------
+    // Description:
+    // Fills `out` with every reservation of the vehicles registered to
+    // `phone` (see VehicleIO::findLicensesByPhone), grouped by vehicle
+    // and in file order within each. Returns true if the phone number
+    // has at least one vehicle.
+    // Precondition:
+    // File must be open; VehicleIO open
+    static bool findReservationsByPhone(
+        std::string_view phone,        // [in] Caller's phone number
+        std::vector<Reservation>& out  // [out] Their reservations
     );
 
     /// Returns true if there is at least one reservation for the given sailing
-    static bool hasReservationsForSailing(const std::string& sailingID);
+    static bool hasReservationsForSailing(std::string_view sailingID);
+
+    //------
+    // Description:
+    // Reads every reservation of one sailing into `out`, in file order,
+    // with one pass over its day's shard. Returns true if successful.
+    // Precondition:
+    // File must be open
+    static bool readReservationsForSailing(
+        std::string_view sailingID,    // [in] Sailing to read
+        std::vector<Reservation>& out  // [out] Its reservations
+    );
+
+    //------
+    // Description:
+    // Removes every reservation of `sailingID` and writes `moved`, their
+    // replacements on other sailings, as one batch: the replacements are
+    // written and their shards flushed first, then the old slots are
+    // freed. Returns false only before the first old slot is freed: if a
+    // replacement cannot be written or flushed, those already written are
+    // freed again and the sailing keeps its reservations. Once the
+    // replacements are flushed the batch counts as done; an old slot that
+    // cannot be freed is reported and left on `sailingID`.
+    // Precondition:
+    // File must be open; no replacement is on `sailingID`
+    static bool replaceSailingReservations(
+        std::string_view sailingID,           // [in] Sailing being emptied
+        const std::vector<Reservation>& moved // [in] Reservations to write
+    );
+
+    //------
+    // Description:
+    // Rewrites in place the reservations of `sailingID` whose licenses
+    // appear in `changed`, with one pass over its shard and one flush.
+    // Returns true if every one of them was found and written.
+    // Precondition:
+    // File must be open; every entry of `changed` is on `sailingID`
+    static bool updateReservations(
+        std::string_view sailingID,             // [in] Sailing of the reservations
+        const std::vector<Reservation>& changed // [in] Their new contents
+    );
+
+    //------
+    // Description:
+    // Reads every reservation record into `out` in one sequential pass.
+    // Returns true if successful.
+    // Precondition:
+    // File must be open
+    static bool readAllReservations(
+        std::vector<Reservation>& out  // [out] all stored reservations
+    );
+
+    //------
+    // Description:
+    // Reads every reservation of one shard into `out`. Returns true if
+    // successful, including when the shard has no file.
+    // Precondition:
+    // File must be open
+    static bool readShard(
+        int shard,                     // [in] Shard to read, see shardOf
+        std::vector<Reservation>& out  // [out] its reservations
+    );
+
+    //------
+    // Description:
+    // Deletes every reservation in a shard by removing its file. Returns
+    // true if successful or if the shard had no file. Returns false,
+    // keeping the file, while any reservation in it is not checked in:
+    // sailing IDs only carry a day of the month, so an earlier day's
+    // shard may already hold next month's bookings. The revenue ledger
+    // keeps the shard's totals until it is next built.
+    // Precondition:
+    // File must be open
+    static bool dropShard(
+        int shard  // [in] Shard to drop, see shardOf
+    );
+
+    //------
+    // Description:
+    // Moves a shard's file into `dir`, leaving the shard empty. Returns
+    // true if successful or if the shard had no file; refuses as
+    // dropShard does.
+    // Precondition:
+    // File must be open; `dir` exists on the same file system
+    static bool archiveShard(
+        int shard,            // [in] Shard to archive, see shardOf
+        std::string_view dir  // [in] Destination directory
+    );
+
+    //------
+    // Description:
+    // Sets `sailingID` to the sailing of a reservation in `shard` that is
+    // not checked in yet. Returns false if every one is checked in.
+    // Precondition:
+    // File must be open
+    static bool findOpenBooking(
+        int shard,              // [in] Shard to scan, see shardOf
+        std::string& sailingID  // [out] A sailing with an open booking
+    );
 
 private:
-    // Private member variables would be declared here
-    // Example:
-    // std::fstream dataFile;
-    // std::string currentFileName;
-    // bool isOpen;
-};
\ No newline at end of file
+    // Reads each reservation of `license` through the license index,
+    // building it first if needed, into one record on the stack and
+    // passes it to `visit(target, res)` until that returns false. Returns
+    // false if a read fails.
+    static bool visitLicense(std::string_view license,
+                             bool (*visit)(void* target, const Reservation& res),
+                             void* target);
+
+    // Appends the reservations of `license` to `out` through visitLicense
+    static bool readReservationsForLicense(std::string_view license,
+                                           std::vector<Reservation>& out);
+
+    // Fills the license index with one scan of every shard
+    static void buildLicenseIndex();
+
+    // Finds the live reservation of a sailing and license in one shard,
+    // a block at a time; `slot` is where it lives
+    static bool findInShard(RecordFile& file, std::string_view sailingID,
+                            std::string_view license, Reservation& out, size_t& slot);
+
+    // As findInShard, but reads only the license's slots in that shard
+    // once the license index has been built
+    static bool locate(RecordFile& file, std::string_view sailingID,
+                       std::string_view license, Reservation& out, size_t& slot);
+};
+
+#endif // RESERVATION_IO_H
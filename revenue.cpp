@@ -0,0 +1,247 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// revenue.cpp
+// Description:
+// Implementation of the RevenueLedger class. Per-sailing totals live in a
+// hash map; a Fenwick (binary indexed) tree over departure slots
+// (day x hour) provides range sums over departure dates.
+//
+// Revision History:
+// Rev. 1 - 2025/08/12 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/31 - Team 12
+// - Checkpoint save and per-shard restore
+//*******************************
+
+#include "revenue.h"
+#include "reservation.h"
+#include "reservation_io.h"
+#include "sailing.h"
+#include "keys.h"
+#include "checkpoint.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    const int MAX_DAY   = 31;
+    const int HOURS     = 24;
+    const int NUM_SLOTS = MAX_DAY * HOURS;
+
+    std::unordered_map<SailingKey, RevenueLedger::Totals> bySailing;
+    std::vector<RevenueLedger::Totals> slotTree(NUM_SLOTS + 1);  // 1-based Fenwick tree
+
+    // Departure slot for a sailing ID, or -1 if the ID cannot be parsed.
+    int slotFor(std::string_view sailingID) {
+        std::string term;
+        int day = 0, hour = 0;
+        if (!Sailing::parseSailingID(sailingID, term, day, hour)) return -1;
+        if (day < 1 || day > MAX_DAY || hour < 0 || hour >= HOURS) return -1;
+        return (day - 1) * HOURS + hour;
+    }
+
+    void treeAdd(int slot, const RevenueLedger::Totals& delta) {
+        for (int i = slot + 1; i <= NUM_SLOTS; i += i & -i)
+            slotTree[i] += delta;
+    }
+
+    // Sum of slots [0, slot)
+    RevenueLedger::Totals treePrefix(int slot) {
+        RevenueLedger::Totals sum;
+        for (int i = slot; i > 0; i -= i & -i)
+            sum += slotTree[i];
+        return sum;
+    }
+
+    // Apply one signed delta to the sailing entry and the slot tree together.
+    void applyDelta(std::string_view sailingID, const RevenueLedger::Totals& delta) {
+        SailingKey key(sailingID);
+        RevenueLedger::Totals& entry = bySailing[key];
+        entry += delta;
+        if (entry.bookings <= 0) bySailing.erase(key);
+
+        int slot = slotFor(sailingID);
+        if (slot >= 0) treeAdd(slot, delta);
+    }
+
+    // One sailing's totals in the checkpoint
+    struct LedgerRow {
+        char    sailingID[32];
+        double  booked;
+        double  checkedIn;
+        double  highLane;
+        double  lowLane;
+        int32_t bookings;
+        int32_t unused;
+    };
+    static_assert(sizeof(LedgerRow) == RevenueLedger::CHECKPOINT_ROW, "ledger rows are packed");
+
+    RevenueLedger::Totals bookingDelta(float fare, bool usedHighLane, bool checkedIn) {
+        RevenueLedger::Totals d;
+        d.booked    = fare;
+        d.checkedIn = checkedIn ? fare : 0.0;
+        d.highLane  = usedHighLane ? fare : 0.0;
+        d.lowLane   = usedHighLane ? 0.0 : fare;
+        d.bookings  = 1;
+        return d;
+    }
+}
+
+RevenueLedger::Totals& RevenueLedger::Totals::operator+=(const Totals& other) {
+    booked    += other.booked;
+    checkedIn += other.checkedIn;
+    highLane  += other.highLane;
+    lowLane   += other.lowLane;
+    bookings  += other.bookings;
+    return *this;
+}
+
+RevenueLedger::Totals& RevenueLedger::Totals::operator-=(const Totals& other) {
+    booked    -= other.booked;
+    checkedIn -= other.checkedIn;
+    highLane  -= other.highLane;
+    lowLane   -= other.lowLane;
+    bookings  -= other.bookings;
+    return *this;
+}
+
+//------
+// Description:
+// Builds the ledger from the reservations file.
+bool RevenueLedger::init() {
+    shutdown();
+
+    // 1) Totals of the shards unchanged since the checkpoint
+    bool current[ReservationIO::SHARD_COUNT] = {};
+    Checkpoint::View view;
+    if (Checkpoint::section(Checkpoint::REVENUE, CHECKPOINT_ROW, view)) {
+        for (int shard = 0; shard < ReservationIO::SHARD_COUNT; ++shard)
+            current[shard] = Checkpoint::isCurrent(ReservationIO::shardPath(shard));
+        LedgerRow row;
+        for (size_t i = 0; i < view.rows; ++i) {
+            std::memcpy(&row, view.data + i * CHECKPOINT_ROW, sizeof row);
+            std::string_view id = fieldView(row.sailingID);
+            if (!current[ReservationIO::shardOf(id)]) continue;
+            Totals t;
+            t.booked    = row.booked;
+            t.checkedIn = row.checkedIn;
+            t.highLane  = row.highLane;
+            t.lowLane   = row.lowLane;
+            t.bookings  = row.bookings;
+            applyDelta(id, t);
+        }
+    }
+
+    // 2) Every other shard is scanned
+    std::vector<Reservation> shard;
+    for (int s = 0; s < ReservationIO::SHARD_COUNT; ++s) {
+        if (current[s]) continue;
+        if (!ReservationIO::readShard(s, shard)) return false;
+        for (const auto& res : shard) {
+            applyDelta(res.currentSailingID.view(),
+                       bookingDelta(res.currentFare, res.usedHighLane, res.checkedIn));
+        }
+    }
+    return true;
+}
+
+size_t RevenueLedger::saveCheckpoint(std::vector<char>& out) {
+    size_t at = out.size();
+    out.resize(at + bySailing.size() * CHECKPOINT_ROW);
+    LedgerRow row;
+    for (const auto& [key, t] : bySailing) {
+        std::memset(&row, 0, sizeof row);
+        std::memcpy(row.sailingID, key.data(), std::min(sizeof row.sailingID, key.view().size()));
+        row.booked    = t.booked;
+        row.checkedIn = t.checkedIn;
+        row.highLane  = t.highLane;
+        row.lowLane   = t.lowLane;
+        row.bookings  = t.bookings;
+        std::memcpy(out.data() + at, &row, sizeof row);
+        at += sizeof row;
+    }
+    return bySailing.size();
+}
+
+//------
+// Description:
+// Discards all in-memory totals.
+void RevenueLedger::shutdown() {
+    bySailing.clear();
+    slotTree.assign(NUM_SLOTS + 1, Totals());
+}
+
+void RevenueLedger::recordBooking(std::string_view sailingID,
+                                  float fare,
+                                  bool usedHighLane)
+{
+    applyDelta(sailingID, bookingDelta(fare, usedHighLane, false));
+}
+
+void RevenueLedger::recordCancellation(std::string_view sailingID,
+                                       float fare,
+                                       bool usedHighLane,
+                                       bool checkedIn)
+{
+    Totals d;
+    d -= bookingDelta(fare, usedHighLane, checkedIn);
+    applyDelta(sailingID, d);
+}
+
+void RevenueLedger::recordCheckIn(std::string_view sailingID, float fare) {
+    Totals d;
+    d.checkedIn = fare;
+    applyDelta(sailingID, d);
+}
+
+bool RevenueLedger::getSailingRevenue(std::string_view sailingID, Totals& out) {
+    auto it = bySailing.find(SailingKey(sailingID));
+    if (it == bySailing.end()) return false;
+    out = it->second;
+    return true;
+}
+
+RevenueLedger::Totals RevenueLedger::getRevenueForDays(int firstDay, int lastDay) {
+    if (firstDay < 1) firstDay = 1;
+    if (lastDay > MAX_DAY) lastDay = MAX_DAY;
+    Totals sum;
+    if (firstDay > lastDay) return sum;
+    sum = treePrefix(lastDay * HOURS);
+    sum -= treePrefix((firstDay - 1) * HOURS);
+    return sum;
+}
+
+void RevenueLedger::printRevenueReport(int firstDay, int lastDay) {
+    const int w1 = 6, w2 = 10, w3 = 14, w4 = 14, w5 = 14, w6 = 14;
+    std::cout << std::left
+              << std::setw(w1) << "Day"
+              << std::setw(w2) << "Bookings"
+              << std::setw(w3) << "Booked($)"
+              << std::setw(w4) << "CheckedIn($)"
+              << std::setw(w5) << "HighLane($)"
+              << std::setw(w6) << "LowLane($)"
+              << "\n"
+              << std::string(w1+w2+w3+w4+w5+w6, '=') << "\n"
+              << std::fixed << std::setprecision(2);
+
+    auto printRow = [&](const std::string& label, const Totals& t) {
+        std::cout << std::left
+                  << std::setw(w1) << label
+                  << std::setw(w2) << t.bookings
+                  << std::setw(w3) << t.booked
+                  << std::setw(w4) << t.checkedIn
+                  << std::setw(w5) << t.highLane
+                  << std::setw(w6) << t.lowLane
+                  << "\n";
+    };
+
+    for (int day = firstDay; day <= lastDay; ++day) {
+        Totals t = getRevenueForDays(day, day);
+        if (t.bookings > 0) printRow(std::to_string(day), t);
+    }
+    std::cout << std::string(w1+w2+w3+w4+w5+w6, '-') << "\n";
+    printRow("Total", getRevenueForDays(firstDay, lastDay));
+}
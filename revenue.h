@@ -0,0 +1,134 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// revenue.h
+// Description:
+// This class keeps running fare totals per sailing (booked versus
+// checked-in, high-lane versus low-lane). The ledger is built from the
+// reservations file once at startup and then adjusted by the Reservation
+// class after each create, cancel and check-in has been written to disk.
+// Totals are also indexed by departure slot so ranges of days can be
+// summed without touching the reservations file.
+//
+// Revision History:
+// Rev. 1 - 2025/08/12 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/31 - Team 12
+// - Per-sailing totals restored from the startup checkpoint for every
+//   shard unchanged since it was written
+//*******************************
+
+#ifndef REVENUE_H
+#define REVENUE_H
+
+#include <string_view>
+#include <vector>
+
+class RevenueLedger {
+public:
+    // Fare totals for one sailing or for a range of departures
+    struct Totals {
+        double booked    = 0.0;  // fares of all current reservations
+        double checkedIn = 0.0;  // fares of reservations logged as arrived
+        double highLane  = 0.0;  // booked fares in the high-ceiling lane
+        double lowLane   = 0.0;  // booked fares in the low-ceiling lane
+        int    bookings  = 0;    // number of current reservations
+
+        Totals& operator+=(const Totals& other);
+        Totals& operator-=(const Totals& other);
+    };
+
+    // Bytes per sailing in the checkpoint: its ID, four fare totals and
+    // the booking count (padded)
+    static const size_t CHECKPOINT_ROW = 32 + 4 * sizeof(double) + 8;
+
+    //------
+    // Description:
+    // Builds the ledger from the reservations file. Returns true if successful.
+    // Shards unchanged since the checkpoint are taken from it; the rest
+    // are scanned.
+    // Precondition:
+    // Reservation file must be open
+    static bool init();
+
+    //------
+    // Description:
+    // Appends the per-sailing totals to `out` in checkpoint layout and
+    // returns the number of sailings.
+    // Precondition:
+    // None
+    static size_t saveCheckpoint(std::vector<char>& out);
+
+    //------
+    // Description:
+    // Discards all in-memory totals.
+    // Precondition:
+    // None
+    static void shutdown();
+
+    //------
+    // Description:
+    // Adds a newly persisted reservation to the ledger.
+    // Precondition:
+    // Reservation record has been written successfully
+    static void recordBooking(
+        std::string_view sailingID,  // [in] Sailing of the reservation
+        float fare,                  // [in] Fare charged
+        bool usedHighLane            // [in] true if placed in high lane
+    );
+
+    //------
+    // Description:
+    // Removes a deleted reservation from the ledger.
+    // Precondition:
+    // Reservation record has been deleted successfully
+    static void recordCancellation(
+        std::string_view sailingID,  // [in] Sailing of the reservation
+        float fare,                  // [in] Fare charged
+        bool usedHighLane,           // [in] true if placed in high lane
+        bool checkedIn               // [in] true if it had been checked in
+    );
+
+    //------
+    // Description:
+    // Moves a reservation's fare into the checked-in total.
+    // Precondition:
+    // Reservation has been marked checked in successfully
+    static void recordCheckIn(
+        std::string_view sailingID,  // [in] Sailing of the reservation
+        float fare                   // [in] Fare charged
+    );
+
+    //------
+    // Description:
+    // Gets the totals for one sailing in O(1). Returns false if the sailing
+    // has no reservations in the ledger.
+    // Precondition:
+    // Ledger must be initialized
+    static bool getSailingRevenue(
+        std::string_view sailingID,  // [in] Sailing to look up
+        Totals& out                  // [out] Totals for the sailing
+    );
+
+    //------
+    // Description:
+    // Sums the totals of all sailings departing on days first..last
+    // (inclusive) in O(log n).
+    // Precondition:
+    // 1 <= firstDay <= lastDay <= 31
+    static Totals getRevenueForDays(
+        int firstDay,  // [in] First departure day (DD)
+        int lastDay    // [in] Last departure day (DD)
+    );
+
+    //------
+    // Description:
+    // Prints per-day and total revenue for days first..last.
+    // Precondition:
+    // Ledger must be initialized
+    static void printRevenueReport(
+        int firstDay,  // [in] First departure day (DD)
+        int lastDay    // [in] Last departure day (DD)
+    );
+};
+
+#endif // REVENUE_H
@@ -12,31 +12,41 @@
 
 #include "sailing.h"    // For Sailing interface :contentReference[oaicite:2]{index=2}
 #include "sailing_io.h" // For low‑level I/O
+#include "availability.h"
 #include "vessel.h"
+#include "stats.h"
+#include "trace.h"
+#include <charconv>
 #include <iostream>
 #include <stdexcept>
 #include <limits>
 #include <iomanip>
+#include <cstdlib>
 
 //---------------------------------------------------------
-// static void Sailing::init()
+// static bool Sailing::init()
 // Initialize the sailing subsystem, opening and resetting its file.
-void Sailing::init() {
-    SailingIO::open();
+bool Sailing::init() {
+    if (!SailingIO::open()) return false;
     SailingIO::reset();
+    if (!AvailabilityTable::restore() && !AvailabilityTable::rebuild()) return false;
+    SailingIO::loadIdFilter();
+    return true;
 }
 
-bool Sailing::createSailing(const std::string& vesselName,
-                            const std::string& departTerm,
-                            const std::string& departDay,
-                            const std::string& departTime)
+bool Sailing::createSailing(std::string_view vesselName,
+                            std::string_view departTerm,
+                            std::string_view departDay,
+                            std::string_view departTime)
 {
+    STATS_SCOPE(CREATE_SAILING);
+    Trace::recordCreateSailing(vesselName, departTerm, departDay, departTime);
     // 1) Build the sailing ID
-    std::string termCode = departTerm.substr(0, 3);
-    for (auto& c : termCode) {
+    std::string sid(departTerm.substr(0, 3));
+    for (auto& c : sid) {
         c = static_cast<char>(toupper(c));
     }
-    std::string sid = termCode + "-" + departDay + "-" + departTime;
+    sid.append("-").append(departDay).append("-").append(departTime);
 
     // 2) Reject duplicates
     if (checkSailingExists(sid)) {
@@ -51,7 +61,7 @@ bool Sailing::createSailing(const std::string& vesselName,
     }
 
     // 4) Pull the current LRL/HRL off the vessel
-    float lrl = 0.0f, hrl = 0.0f;
+    Centimetres lrl = 0, hrl = 0;
     if (!Vessel::getLRL(vesselName, lrl) ||
         !Vessel::getHRL(vesselName, hrl))
     {
@@ -61,7 +71,7 @@ bool Sailing::createSailing(const std::string& vesselName,
     }
 
     // 5) Create & persist
-    Record rec(sid.c_str(), vesselName.c_str(), hrl, lrl);
+    Record rec(sid, vesselName, hrl, lrl);
     if (!SailingIO::createSailing(rec)) {
         std::cerr << "Error: Failed to write new sailing record.\n";
         return false;
@@ -71,66 +81,68 @@ bool Sailing::createSailing(const std::string& vesselName,
     return true;
 }
 
-bool Sailing::deleteSailing(const std::string& sailingID) {
+bool Sailing::deleteSailing(std::string_view sailingID) {
+    STATS_SCOPE(DELETE_SAILING);
+    Trace::recordDeleteSailing(sailingID);
     if (!checkSailingExists(sailingID)) return false;
     else return SailingIO::deleteSailing(sailingID);
 }
 
-bool Sailing::checkVesselHasSailings(const std::string& vesselName) {
+bool Sailing::checkVesselHasSailings(std::string_view vesselName) {
     return SailingIO::checkSailingsForVessel(vesselName);
 }
 
-bool Sailing::checkSailingVehicleCapacity(const std::string& sailingID) {
+bool Sailing::checkSailingVehicleCapacity(std::string_view sailingID) {
     return SailingIO::checkSailingVehicleCapacity(sailingID);
 }
 
-bool Sailing::checkSailingPeopleCapacity(const std::string& sailingID,
+bool Sailing::checkSailingPeopleCapacity(std::string_view sailingID,
                                           unsigned int occupants)
 {
     return SailingIO::checkSailingPeopleCapacity(sailingID, occupants);
 }
 
-bool Sailing::getHighRemLaneLength(const std::string& sailingID, float length) {
+bool Sailing::getHighRemLaneLength(std::string_view sailingID, Centimetres length) {
     return SailingIO::getHighRemLaneLength(sailingID, length);
 }
 
-bool Sailing::getLowRemLaneLength(const std::string& sailingID, float length) {
+bool Sailing::getLowRemLaneLength(std::string_view sailingID, Centimetres length) {
     return SailingIO::getLowRemLaneLength(sailingID, length);
 }
 
-bool Sailing::updateOccupants(const std::string& sailingID,
+bool Sailing::updateOccupants(std::string_view sailingID,
                                 int numPeople,
-                                float vehicleLength) 
+                                Centimetres vehicleLength) 
 {
     return SailingIO::updateOccupants(sailingID,
                                 numPeople,
                                 vehicleLength);
 }
 
-void Sailing::updateSailingForHigh(const std::string& sailingID,
+void Sailing::updateSailingForHigh(std::string_view sailingID,
                                    int occupants,
-                                   float length)
+                                   Centimetres length)
 {
     SailingIO::updateSailingForHigh(sailingID, length);
 }
 
-void Sailing::updateSailingForLow(const std::string& sailingID,
+void Sailing::updateSailingForLow(std::string_view sailingID,
                                   int occupants,
-                                  float length)
+                                  Centimetres length)
 {
     SailingIO::updateSailingForLow(sailingID, length);
 }
 
-int Sailing::getPeopleOccupantsForReservation(const std::string& sailingID) {
+int Sailing::getPeopleOccupantsForReservation(std::string_view sailingID) {
     checkSailingExists(sailingID);
     return SailingIO::getPeopleOccupants(sailingID);
 }
 
-int Sailing::getVehicleOccupantsForReservation(const std::string& sailingID) {
+int Sailing::getVehicleOccupantsForReservation(std::string_view sailingID) {
     return SailingIO::getVehicleOccupants(sailingID);
 }
 
-bool Sailing::checkSailingExists(const std::string& sailingID) {
+bool Sailing::checkSailingExists(std::string_view sailingID) {
 
     return SailingIO::checkSailingExists(sailingID);
 }
@@ -141,9 +153,37 @@ void Sailing::printSailingReport() {
 
 void Sailing::shutdown() {
     SailingIO::close();
+    AvailabilityTable::clear();
+}
+
+std::vector<std::string> Sailing::findSailingsWithRoom(Centimetres height,
+                                                       Centimetres length,
+                                                       unsigned int occupants,
+                                                       int firstDay,
+                                                       int lastDay)
+{
+    return AvailabilityTable::findSailingsWithRoom(height, length, occupants,
+                                                   firstDay, lastDay);
+}
+
+bool Sailing::parseSailingID(std::string_view sailingID,
+                             std::string& terminal,
+                             int& day,
+                             int& hour)
+{
+    size_t p1 = sailingID.find('-');
+    if (p1 == std::string_view::npos) return false;
+    size_t p2 = sailingID.find('-', p1 + 1);
+    if (p2 == std::string_view::npos) return false;
+    terminal.assign(sailingID.data(), p1);
+    // like atoi: stop at the first non-digit, 0 if there are none
+    day = hour = 0;
+    std::from_chars(sailingID.data() + p1 + 1, sailingID.data() + p2, day);
+    std::from_chars(sailingID.data() + p2 + 1, sailingID.data() + sailingID.size(), hour);
+    return true;
 }
 
-void Sailing::printVehicleReport(const std::string& sailingID) {
+void Sailing::printVehicleReport(std::string_view sailingID) {
     char choice;
     SailingIO::printCheckVehicles(sailingID);
     std::cout << "End of Report. Enter <0> to return to the main menu.\n";
@@ -3,12 +3,19 @@
 // sailing.h
 // Version History:
 //   1.1 2025-07-20  Added Record definition with field defaults
+//   1.2 2025-08-25  Lane lengths in whole centimetres
+//   1.3 2025-09-02  init reports failure
 //============================================================
 #ifndef SAILING_H
 #define SAILING_H
 
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <cstddef>
+#include <cstring>
+#include <vector>
+#include "units.h"
 
 // The Sailing Class encapsulates all sailing-related scenarios.
 // All methods are static; no class instance is required.
@@ -18,13 +25,16 @@ public:
     static const size_t ID_LEN = 32;
     static const size_t VLEN   = 32;
 
+    // Gap left behind every vehicle in a lane
+    static constexpr Centimetres VEHICLE_BUF_CM = 50;
+
     // In-memory representation of a sailing record
     struct Record {
         char   sailingID[ID_LEN];   // Primary key, fixed-length C-string
         char   vessel_ID[VLEN];     // Foreign key, fixed-length C-string
-        float  HRL;                 // High Remaining Length
-        float  LRL;                 // Low Remaining Length
-        float LCU;                  // Lane Capacity Used
+        Centimetres HRL_cm;         // High Remaining Length
+        Centimetres LRL_cm;         // Low Remaining Length
+        Centimetres LCU_cm;         // Lane Capacity Used
         int    ppl_on_board;            // Current People occupant count
         int    veh_on_board;            // Current Vehicle occupant count
 
@@ -33,68 +43,69 @@ public:
         Record() {
             std::memset(sailingID, 0, ID_LEN);
             std::memset(vessel_ID, 0, VLEN);
-            HRL = 0.0f;  LRL = 0.0f; LCU = 0.0f;  ppl_on_board = 0; veh_on_board = 0;
+            HRL_cm = 0;  LRL_cm = 0; LCU_cm = 0;  ppl_on_board = 0; veh_on_board = 0;
         }
 
-        // Convenience constructor from C-strings
-        Record(const char* sid, const char* vid, float hrl_value, float lrl_value) {
-            std::strncpy(sailingID, sid, ID_LEN);
-            sailingID[ID_LEN - 1] = '\0';
-            std::strncpy(vessel_ID, vid, VLEN);
-            vessel_ID[VLEN - 1] = '\0';
-            HRL = hrl_value;
-            LRL = lrl_value;
-            LCU = 0.0f;
+        // Convenience constructor from IDs (truncated to fit)
+        Record(std::string_view sid, std::string_view vid, Centimetres hrl_value, Centimetres lrl_value) {
+            std::memset(sailingID, 0, ID_LEN);
+            std::memcpy(sailingID, sid.data(), std::min(sid.size(), ID_LEN - 1));
+            std::memset(vessel_ID, 0, VLEN);
+            std::memcpy(vessel_ID, vid.data(), std::min(vid.size(), VLEN - 1));
+            HRL_cm = hrl_value;
+            LRL_cm = lrl_value;
+            LCU_cm = 0;
             ppl_on_board = 0;
             veh_on_board = 0;
         }
     };
 
     // Initialize the sailing subsystem, opening and resetting its file.
-    static void init();
+    // Returns false if the file cannot be opened.
+    static bool init();
 
     // Create a new sailing record, prompting user for required fields.
-    static bool createSailing(const std::string& vesselName,
-                            const std::string& departTerm,
-                            const std::string& departDay,
-                            const std::string& departTime);
+    static bool createSailing(std::string_view vesselName,
+                              std::string_view departTerm,
+                              std::string_view departDay,
+                              std::string_view departTime);
     // add arguments, print sailing ID: "sailing successfully created..."
 
     // Delete an existing sailing by ID. Throws if not found.
-    static bool deleteSailing(const std::string& sailingID);
+    static bool deleteSailing(std::string_view sailingID);
 
     // Check whether a given vessel has any sailings scheduled.
-    static bool checkVesselHasSailings(const std::string& vesselName);
+    static bool checkVesselHasSailings(std::string_view vesselName);
 
 
     // Retrieve the number of people currently reserved on a sailing.
-    static int getPeopleOccupantsForReservation(const std::string& sailingID);
+    static int getPeopleOccupantsForReservation(std::string_view sailingID);
 
     // Retrieve the number of vehicles currently reserved on a sailing.
-    static int getVehicleOccupantsForReservation(const std::string& sailingID);
+    static int getVehicleOccupantsForReservation(std::string_view sailingID);
 
-    static bool checkSailingVehicleCapacity(const std::string& sailingID); 
+    static bool checkSailingVehicleCapacity(std::string_view sailingID); 
     // which returns true if the vessel capacity can take 1 additional vehicle
 
-    static bool checkSailingPeopleCapacity(const std::string& sailingID, unsigned int occupants); 
+    static bool checkSailingPeopleCapacity(std::string_view sailingID, unsigned int occupants); 
     // which returns true if the vessel people capacity can take on x number of occupants
 
-    static bool getHighRemLaneLength(const std::string& sailingID, float length); 
-    // which returns true if the high ceiling lane length has room for x metres in length
+    static bool getHighRemLaneLength(std::string_view sailingID, Centimetres length); 
+    // which returns true if the high ceiling lane length has room for x cm in length
 
-    static bool getLowRemLaneLength(const std::string& sailingID, float length); 
-    // which returns true if the low ceiling lane length has room for x metres in length
+    static bool getLowRemLaneLength(std::string_view sailingID, Centimetres length); 
+    // which returns true if the low ceiling lane length has room for x cm in length
 
     // updates vehicle and people occupants when a reservation checks in
-    static bool updateOccupants(const std::string& sailingID,
+    static bool updateOccupants(std::string_view sailingID,
                                 int numPeople,
-                                float vehicleLength);
+                                Centimetres vehicleLength);
 
-    static void updateSailingForHigh(const std::string& sailingID, int occupants, float length); 
-    // which returns nothing, just updates sailing records by subtracting x metres from high lane length and subtracing x occupants from capacity
+    static void updateSailingForHigh(std::string_view sailingID, int occupants, Centimetres length); 
+    // which returns nothing, just updates sailing records by subtracting x cm from high lane length and subtracing x occupants from capacity
 
-    static void updateSailingForLow(const std::string& sailingID, int occupants, float length); 
-    // which returns nothing, just updates sailing records by subtracting x metres from low lane length and subtracing x occupants from capacity
+    static void updateSailingForLow(std::string_view sailingID, int occupants, Centimetres length); 
+    // which returns nothing, just updates sailing records by subtracting x cm from low lane length and subtracing x occupants from capacity
 
     // Print a paginated report of all sailings.
     static void printSailingReport();
@@ -103,10 +114,25 @@ public:
     static void shutdown();
 
     // Ensure the given sailingID exists; throws if not.
-    static bool checkSailingExists(const std::string& sailingID);
+    static bool checkSailingExists(std::string_view sailingID);
 
     // Print a report with info about vehicles aboard a sailing
-    static void printVehicleReport(const std::string& sailingID);
+    static void printVehicleReport(std::string_view sailingID);
+
+    // Split a "TER-DD-HH" sailing ID into terminal code, day and hour.
+    // Returns false if the ID is malformed.
+    static bool parseSailingID(std::string_view sailingID,
+                               std::string& terminal,
+                               int& day,
+                               int& hour);
+
+    // Return the IDs of sailings departing on days firstDay..lastDay that
+    // still have lane and passenger room for the given vehicle.
+    static std::vector<std::string> findSailingsWithRoom(Centimetres height,
+                                                         Centimetres length,
+                                                         unsigned int occupants,
+                                                         int firstDay,
+                                                         int lastDay);
 
 private:
 };
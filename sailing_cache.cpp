@@ -0,0 +1,91 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// sailing_cache.cpp
+// Description:
+// Implementation of the SailingCache class (see sailing_cache.h).
+//
+// Revision History:
+// Rev. 1 - 2025/09/01 - Team 12
+// - Initial implementation
+//*******************************
+
+#include "sailing_cache.h"
+#include <cstdlib>
+#include <iomanip>
+
+// A probe longer than a key would be truncated onto another ID, so such
+// IDs are never cached or looked up.
+static bool cacheable(std::string_view sailingID) {
+    return !sailingID.empty() && sailingID.size() <= SailingKey::CAPACITY;
+}
+
+bool SailingCache::find(std::string_view sailingID, Sailing::Record& out, size_t& slot) {
+    if (limit == 0 || !cacheable(sailingID)) return false;
+    auto it = index.find(SailingKey(sailingID));
+    if (it == index.end()) {
+        ++counts.misses;
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    out  = it->second->rec;
+    slot = it->second->slot;
+    ++counts.hits;
+    return true;
+}
+
+void SailingCache::put(const Sailing::Record& rec, size_t slot) {
+    std::string_view id = fieldView(rec.sailingID);
+    if (limit == 0 || !cacheable(id)) return;
+    SailingKey key(id);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        it->second->rec  = rec;
+        it->second->slot = slot;
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    evictTo(limit - 1);
+    entries.push_front(Entry{ key, rec, slot });
+    index.emplace(key, entries.begin());
+}
+
+void SailingCache::erase(std::string_view sailingID) {
+    if (!cacheable(sailingID)) return;
+    auto it = index.find(SailingKey(sailingID));
+    if (it == index.end()) return;
+    entries.erase(it->second);
+    index.erase(it);
+}
+
+void SailingCache::clear() {
+    entries.clear();
+    index.clear();
+}
+
+void SailingCache::setCapacity(size_t records) {
+    limit = records;
+    evictTo(limit);
+}
+
+void SailingCache::initFromEnvironment() {
+    const char* env = std::getenv("SETSAIL_SAILING_CACHE");
+    if (env && *env) setCapacity(static_cast<size_t>(std::strtoul(env, nullptr, 10)));
+}
+
+void SailingCache::printReport(std::ostream& out) const {
+    uint64_t lookups = counts.hits + counts.misses;
+    out << "Sailing cache: " << entries.size() << "/" << limit << " records, "
+        << counts.hits << " hits, " << counts.misses << " misses";
+    if (lookups > 0)
+        out << " (" << std::fixed << std::setprecision(1)
+            << 100.0 * counts.hits / lookups << "% hit)";
+    out << ", " << counts.evictions << " evictions\n";
+}
+
+void SailingCache::evictTo(size_t records) {
+    while (entries.size() > records) {
+        index.erase(entries.back().id);
+        entries.pop_back();
+        ++counts.evictions;
+    }
+}
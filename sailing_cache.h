@@ -0,0 +1,117 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// sailing_cache.h
+// Description:
+// Bounded least-recently-used cache of Sailing::Records and the slots
+// they occupy in sailings.dat. SailingIO consults it before scanning the
+// file, stores every record a scan finds, writes every update through it
+// and drops entries whose slot a delete changes, so a cached record is
+// always the one on disk.
+//
+// The capacity is set with SETSAIL_SAILING_CACHE (records; 0 turns the
+// cache off) and defaults to DEFAULT_CAPACITY, enough for every sailing
+// of several terminals over the next few days. Hits, misses and
+// evictions are counted for the statistics menu.
+//
+// Revision History:
+// Rev. 1 - 2025/09/01 - Team 12
+// - Initial implementation
+//*******************************
+
+#ifndef SAILING_CACHE_H
+#define SAILING_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <ostream>
+#include <string_view>
+#include <unordered_map>
+#include "sailing.h"
+#include "keys.h"
+
+class SailingCache {
+public:
+    static const size_t DEFAULT_CAPACITY = 256;
+
+    struct Counters {
+        uint64_t hits      = 0;
+        uint64_t misses    = 0;
+        uint64_t evictions = 0;
+    };
+
+    //------
+    // Description:
+    // Copies the cached record of `sailingID` and its slot into `out` and
+    // `slot`, making it the most recently used. Returns false (a miss)
+    // if it is not cached.
+    // Precondition:
+    // None
+    bool find(std::string_view sailingID, Sailing::Record& out, size_t& slot);
+
+    //------
+    // Description:
+    // Caches `rec` at `slot`, replacing any entry for its ID and evicting
+    // the least recently used entry if the cache is full.
+    // Precondition:
+    // `rec` is the record stored at `slot`
+    void put(const Sailing::Record& rec, size_t slot);
+
+    //------
+    // Description:
+    // Drops the entry for `sailingID`, if any.
+    // Precondition:
+    // None
+    void erase(std::string_view sailingID);
+
+    //------
+    // Description:
+    // Drops every entry; the counters are kept.
+    // Precondition:
+    // None
+    void clear();
+
+    //------
+    // Description:
+    // Sets the number of records kept, evicting the least recently used
+    // entries beyond it. 0 disables the cache.
+    // Precondition:
+    // None
+    void setCapacity(size_t records);
+
+    //------
+    // Description:
+    // Sets the capacity from SETSAIL_SAILING_CACHE if it is set.
+    // Precondition:
+    // None
+    void initFromEnvironment();
+
+    //------
+    // Description:
+    // Prints the capacity, fill and counters on one line.
+    // Precondition:
+    // None
+    void printReport(std::ostream& out) const;
+
+    size_t          capacity() const { return limit; }
+    size_t          size() const { return entries.size(); }
+    const Counters& counters() const { return counts; }
+    void            resetCounters() { counts = Counters(); }
+
+private:
+    struct Entry {
+        SailingKey      id;
+        Sailing::Record rec;
+        size_t          slot;
+    };
+    using List = std::list<Entry>;
+
+    void evictTo(size_t records);
+
+    List                                           entries;   // most recent first
+    std::unordered_map<SailingKey, List::iterator> index;
+    size_t                                         limit = DEFAULT_CAPACITY;
+    Counters                                       counts;
+};
+
+#endif // SAILING_CACHE_H
@@ -2,11 +2,24 @@
 // sailing_io.cpp
 // Version History:
 //   1.0 2025-07-20  Initial implementation
+//   1.1 2025-08-26  Records read and written through RecordSchema
+//   1.2 2025-08-27  Versioned file header (RecordFile)
+//   1.3 2025-08-30  Bulk removal for the archive
+//   1.4 2025-08-31  Deletes rewrite the file through a synced temp file
+//   1.5 2025-08-31  Scans read the file in blocks (RecordScanner)
+//   1.6 2025-09-01  Bloom filter of sailing IDs in front of the scans
+//   1.7 2025-09-01  LRU cache of recently used records (SailingCache)
+//   1.8 2025-09-02  readSailing; claimLanes updates both lanes in one write
+//   1.9 2025-09-02  changeVessel
+//   1.10 2025-09-02 flush
+//   1.11 2025-09-02 open reports failure
+//   1.12 2025-09-02 ID filter filled from the availability table
 //============================================================
 //
 // Implements binary, random‑access I/O for Sailing records.
-// Uses unsorted fixed‑length records. On deletion, rewrites
-// the file without the removed record.
+// Uses unsorted fixed‑length records after a RecordFile header.
+// On deletion, the last record is moved into the freed slot; the file is
+// rewritten with RecordFile::replaceAll, never shortened in place.
 //
 //============================================================
 
@@ -15,7 +28,16 @@
 #include "vessel.h"
 #include "vessel_io.h"
 #include "reservation_io.h"
-
+#include "stats.h"
+#include "keys.h"
+#include "availability.h"
+#include "record_file.h"
+#include "record_block.h"
+#include "bloom.h"
+#include "sailing_cache.h"
+
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <iomanip>
@@ -24,135 +46,191 @@
 #include <limits>
 
 namespace {
-    const std::string FILENAME = "sailings.dat";
-    std::fstream fs;
     using Record = Sailing::Record;
-}
+    RecordFile    file("sailings.dat", RecordFile::formatOf<Record>());
+    std::fstream& fs = file.stream();
 
-static constexpr float vehicleBuf = 0.5f;
+    // IDs of the sailings in the file, so unknown IDs skip the scan
+    BloomFilter ids;
 
-void SailingIO::open() {
-    fs.open(FILENAME, std::ios::in | std::ios::out | std::ios::binary);
-    if (!fs) {
-        std::ofstream ofs(FILENAME, std::ios::out | std::ios::binary);
-        ofs.close();
-        fs.open(FILENAME, std::ios::in | std::ios::out | std::ios::binary);
+    // Recently used records, kept equal to the file by every write below
+    SailingCache cache;
+
+    // Refills the ID filter from `all`, the whole file
+    void fillIds(const std::vector<Record>& all) {
+        ids.reset(all.size());
+        for (const Record& rec : all) ids.add(fieldView(rec.sailingID));
+    }
+
+    // Refills the ID filter from the availability table, which holds the
+    // ID of every record and is itself restored from the checkpoint, so
+    // startup does not scan the file for it
+    void loadIds() {
+        const size_t n = AvailabilityTable::size();
+        ids.reset(n);
+        for (size_t row = 0; row < n; ++row) ids.add(AvailabilityTable::idAt(row));
+    }
+
+    // Finds the record of `sailingID` a block at a time; `slot` is where
+    // it lives. Returns false if there is none.
+    bool findSailing(std::string_view sailingID, Record& out, size_t& slot) {
+        if (!ids.mayContain(sailingID)) return false;
+        if (cache.find(sailingID, out, slot)) return true;
+        RecordScanner<Record> scan(file);
+        while (scan.nextBlock()) {
+            for (size_t i = 0; i < scan.size(); ++i) {
+                if (fieldView(scan[i].sailingID) == sailingID) {
+                    out  = scan[i];
+                    slot = scan.firstSlot() + i;
+                    cache.put(out, slot);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Writes `rec` back to `slot`, the cache and the availability row
+    // that mirror it; a passenger capacity is given when the vessel changed
+    void writeSailing(size_t slot, const Record& rec, int maxPassengers = -1) {
+        fs.clear();
+        fs.seekp(file.slotOffset(slot), std::ios::beg);
+        schema::writeRecord(fs, rec);
+        STATS_WRITE(sizeof rec);
+        fs.flush();
+        STATS_FLUSH();
+        if (fs) cache.put(rec, slot);
+        else    cache.erase(fieldView(rec.sailingID));
+        if (maxPassengers < 0) AvailabilityTable::updateRow(slot, rec);
+        else                   AvailabilityTable::updateRow(slot, rec, maxPassengers);
     }
 }
 
+static constexpr Centimetres vehicleBuf = Sailing::VEHICLE_BUF_CM;
+
+bool SailingIO::open() {
+    cache.initFromEnvironment();
+    return file.open();
+}
+
+void SailingIO::loadIdFilter() {
+    loadIds();
+}
+
 void SailingIO::reset() {
-    fs.clear();
-    fs.seekg(0, std::ios::beg);
+    file.rewind();
 }
 
 bool SailingIO::createSailing(const Record& rec) {
+    STATS_SCOPE(SAILING_IO_CREATE);
     // clear any stale error bits, position at end
     fs.clear();
     fs.seekp(0, std::ios::end);
 
-    // write the record
-    fs.write(reinterpret_cast<const char*>(&rec), sizeof(rec));
-    if (!fs) {
+    // write the record, then count it in the header
+    schema::writeRecord(fs, rec);
+    STATS_WRITE(sizeof(rec));
+    if (!fs || !file.addLive(1)) {
         std::cerr << "SailingIO::createSailing — write failed\n";
         return false;
     }
 
     // flush to disk
     fs.flush();
+    STATS_FLUSH();
     if (!fs) {
         std::cerr << "SailingIO::createSailing — flush failed\n";
         return false;
     }
 
+    VesselRecord vRec{};
+    int maxPassengers = VesselIO::readVessel(rec.vessel_ID, vRec) ? vRec.maxPassengers : 0;
+    AvailabilityTable::appendRow(rec, maxPassengers);
+
+    ids.add(fieldView(rec.sailingID));
+    if (ids.needsRebuild()) loadIds();
     return true;
 }
 
-bool SailingIO::deleteSailing(const std::string& sailingID) {
+bool SailingIO::deleteSailing(std::string_view sailingID) {
+    STATS_SCOPE(SAILING_IO_DELETE);
     // 1) Quick check: any reservations?
     if (ReservationIO::hasReservationsForSailing(sailingID))
         return false;
 
-    // 2) Figure out file size and record count
-    fs.clear();
-    fs.seekg(0, std::ios::end);
-    std::streamoff fileSize = fs.tellg();
-    size_t recSize = sizeof(Record);
-    if (fileSize < static_cast<std::streamoff>(recSize))
-        return false;                                 // no records at all
-
-    size_t count = fileSize / recSize;
-
-    // 3) Find the position of the target record
-    fs.clear();
-    fs.seekg(0, std::ios::beg);
-    Record temp;
-    std::streamoff posToDelete = -1;
-    for (size_t i = 0; i < count; ++i) {
-        fs.read(reinterpret_cast<char*>(&temp), recSize);
-        if (std::string(temp.sailingID) == sailingID) {
-            posToDelete = fs.tellg() - static_cast<std::streamoff>(recSize);
-            break;
-        }
-    }
-    if (posToDelete < 0)
+    // 2) Find the target record
+    if (!ids.mayContain(sailingID))
+        return false;                                 // sailingID not found
+    std::vector<Record> all;
+    if (!readAllSailings(all)) return false;
+    size_t slot = 0;
+    while (slot < all.size() && fieldView(all[slot].sailingID) != sailingID) ++slot;
+    if (slot == all.size())
         return false;                                 // sailingID not found
 
-    // 4) Read the last record
-    Record last;
-    fs.seekg((count - 1) * recSize, std::ios::beg);
-    fs.read(reinterpret_cast<char*>(&last), recSize);
+    // 3) Move the last record into its slot and rewrite the file
+    all[slot] = all.back();
+    all.pop_back();
+    if (!file.replaceAll(all))
+        return false;
+    fillIds(all);
+    cache.erase(sailingID);
+    if (slot < all.size()) cache.erase(fieldView(all[slot].sailingID));   // moved
+    AvailabilityTable::removeRow(slot);
 
-    // 5) Overwrite the target with the last record
-    fs.clear();
-    fs.seekp(posToDelete, std::ios::beg);
-    fs.write(reinterpret_cast<const char*>(&last), recSize);
-    fs.flush();
-    fs.close();
+    return true;
+}
 
-    // 6) Truncate the file by one record and re-open
-    std::filesystem::resize_file(FILENAME, fileSize - recSize);
-    open();
+bool SailingIO::removeSailings(const std::vector<std::string>& sortedIDs) {
+    STATS_SCOPE(SAILING_IO_DELETE);
+    std::vector<Record> all;
+    if (!readAllSailings(all)) return false;
+    auto removed = [&](const Record& r) {
+        return std::binary_search(sortedIDs.begin(), sortedIDs.end(),
+                                  fieldView(r.sailingID));
+    };
+    all.erase(std::remove_if(all.begin(), all.end(), removed), all.end());
 
-    return true;
+    // rewrite the file with the sailings that stay, in their old order
+    if (!file.replaceAll(all)) return false;
+    fillIds(all);
+    cache.clear();
+    return AvailabilityTable::rebuild();
 }
 
-bool SailingIO::checkSailingsForVessel(const std::string& vesselName) {
-    reset();
-    Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.vessel_ID) == vesselName)
-            return true;
+bool SailingIO::checkSailingsForVessel(std::string_view vesselName) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
+    RecordScanner<Record> scan(file);
+    while (scan.nextBlock()) {
+        for (const Record& temp : scan)
+            if (fieldView(temp.vessel_ID) == vesselName)
+                return true;
     }
     return false;
 }
 // In sailing_io.cpp
 
-bool SailingIO::updateOccupants(const std::string& sailingID,
+bool SailingIO::updateOccupants(std::string_view sailingID,
                                 int numPeople,
-                                float vehicleLength)
+                                Centimetres vehicleLength)
 {
-    reset();
+    STATS_SCOPE(SAILING_IO_UPDATE);
     Record temp;
-    std::streamoff pos;
-    while ((pos = fs.tellg()), fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            // 1) Adjust cumulative vehicle‐metres + buffer
-            float buf = (vehicleLength > 0 ? vehicleBuf : -vehicleBuf);
-            temp.LCU += (vehicleLength + buf);
-
-            // 2) Adjust people count
-            temp.ppl_on_board += numPeople;
-
-            // 3) Adjust vehicle count (+1 on create, –1 on cancel)
-            temp.veh_on_board += (vehicleLength > 0 ? 1 : -1);
-
-            // write back
-            fs.clear();
-            fs.seekp(pos, std::ios::beg);
-            fs.write(reinterpret_cast<const char*>(&temp), sizeof temp);
-            fs.flush();
-            return true;
-        }
+    size_t slot;
+    if (findSailing(sailingID, temp, slot)) {
+        // 1) Adjust cumulative vehicle‐metres + buffer
+        Centimetres buf = (vehicleLength > 0 ? vehicleBuf : -vehicleBuf);
+        temp.LCU_cm += (vehicleLength + buf);
+
+        // 2) Adjust people count
+        temp.ppl_on_board += numPeople;
+
+        // 3) Adjust vehicle count (+1 on create, –1 on cancel)
+        temp.veh_on_board += (vehicleLength > 0 ? 1 : -1);
+
+        // write back
+        writeSailing(slot, temp);
+        return true;
     }
     std::cerr << "Error: Sailing ID not found: " << sailingID << "\n";
     return false;
@@ -163,147 +241,169 @@ bool SailingIO::updateOccupants(const std::string& sailingID,
 
 // — checkSailingVehicleCapacity —
 // returns true if *either* lane has any room left
-bool SailingIO::checkSailingVehicleCapacity(const std::string& sailingID) {
-    reset();
+bool SailingIO::checkSailingVehicleCapacity(std::string_view sailingID) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            // if either remaining‑high or remaining‑low length is > 0
-            return (temp.HRL > 0.0f) || (temp.LRL > 0.0f);
-        }
+    size_t slot;
+    if (findSailing(sailingID, temp, slot)) {
+        // if either remaining‑high or remaining‑low length is > 0
+        return (temp.HRL_cm > 0) || (temp.LRL_cm > 0);
     }
     return false;
 }
 
 // — checkSailingPeopleCapacity —
 // returns true if we can add `occupants` more without exceeding vessel's passenger cap
-bool SailingIO::checkSailingPeopleCapacity(const std::string& sailingID,
+bool SailingIO::checkSailingPeopleCapacity(std::string_view sailingID,
                                            unsigned int occupants)
 {
-    reset();
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            // read vessel's max passenger capacity
-            VesselRecord vRec;
-            if (!VesselIO::readVessel(temp.vessel_ID, vRec))
-                return false;
-            return (static_cast<unsigned>(temp.ppl_on_board) + occupants)
-                   <= static_cast<unsigned>(vRec.maxPassengers);
-        }
+    size_t slot;
+    if (findSailing(sailingID, temp, slot)) {
+        // read vessel's max passenger capacity
+        VesselRecord vRec;
+        if (!VesselIO::readVessel(temp.vessel_ID, vRec))
+            return false;
+        return (static_cast<unsigned>(temp.ppl_on_board) + occupants)
+               <= static_cast<unsigned>(vRec.maxPassengers);
     }
     return false;
 }
 
 // — getHighRemLaneLength —
-// returns true if the high‑ceiling lane has at least `length` metres free
-bool SailingIO::getHighRemLaneLength(const std::string& sailingID, float length) {
-    reset();
+// returns true if the high‑ceiling lane has at least `length` cm free
+bool SailingIO::getHighRemLaneLength(std::string_view sailingID, Centimetres length) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            return temp.HRL >= ( length + vehicleBuf );
-        }
-    }
-    return false;
+    size_t slot;
+    return findSailing(sailingID, temp, slot)
+        && temp.HRL_cm >= ( length + vehicleBuf );
 }
 
 // — getLowRemLaneLength —
-// returns true if the low‑ceiling lane has at least `length` metres free
-bool SailingIO::getLowRemLaneLength(const std::string& sailingID, float length) {
-    reset();
+// returns true if the low‑ceiling lane has at least `length` cm free
+bool SailingIO::getLowRemLaneLength(std::string_view sailingID, Centimetres length) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            return temp.LRL >= ( length + vehicleBuf );
-        }
-    }
-    return false;
+    size_t slot;
+    return findSailing(sailingID, temp, slot)
+        && temp.LRL_cm >= ( length + vehicleBuf );
 }
 
 // — updateSailingForHigh —
-// subtract `length` metres from HRL and add `occupants` to on_board
-void SailingIO::updateSailingForHigh(const std::string& sailingID,
-                                     float length)
+// subtract `length` cm from HRL and add `occupants` to on_board
+void SailingIO::updateSailingForHigh(std::string_view sailingID,
+                                     Centimetres length)
 {
-    reset();
+    STATS_SCOPE(SAILING_IO_UPDATE);
     Record temp;
-    std::streamoff pos;
-    while ((pos = fs.tellg()), fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            float buf = (length > 0 ? vehicleBuf : -vehicleBuf);
-            temp.HRL -= (length + buf);
-            fs.clear();
-            fs.seekp(pos, std::ios::beg);
-            fs.write(reinterpret_cast<const char*>(&temp), sizeof temp);
-            fs.flush();
-            return;
-        }
+    size_t slot;
+    if (findSailing(sailingID, temp, slot)) {
+        Centimetres buf = (length > 0 ? vehicleBuf : -vehicleBuf);
+        temp.HRL_cm -= (length + buf);
+        writeSailing(slot, temp);
     }
 }
 
-void SailingIO::updateSailingForLow(const std::string& sailingID,
-                                    float length)
+void SailingIO::updateSailingForLow(std::string_view sailingID,
+                                    Centimetres length)
 {
-    reset();
+    STATS_SCOPE(SAILING_IO_UPDATE);
     Record temp;
-    std::streamoff pos;
-    while ((pos = fs.tellg()), fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            float buf = (length > 0 ? vehicleBuf : -vehicleBuf);
-            temp.LRL -= (length + buf);
-            fs.clear();
-            fs.seekp(pos, std::ios::beg);
-            fs.write(reinterpret_cast<const char*>(&temp), sizeof temp);
-            fs.flush();
-            return;
-        }
+    size_t slot;
+    if (findSailing(sailingID, temp, slot)) {
+        Centimetres buf = (length > 0 ? vehicleBuf : -vehicleBuf);
+        temp.LRL_cm -= (length + buf);
+        writeSailing(slot, temp);
     }
 }
 
+// — claimLanes —
+// subtract whole reallocations from both lanes in a single write
+bool SailingIO::claimLanes(std::string_view sailingID,
+                           Centimetres high,
+                           Centimetres low)
+{
+    STATS_SCOPE(SAILING_IO_UPDATE);
+    Record temp;
+    size_t slot;
+    if (!findSailing(sailingID, temp, slot)) return false;
+    temp.HRL_cm -= high;
+    temp.LRL_cm -= low;
+    writeSailing(slot, temp);
+    return static_cast<bool>(fs);
+}
 
-int SailingIO::getPeopleOccupants(const std::string& sailingID) {
-    reset();
+bool SailingIO::readSailing(std::string_view sailingID, Record& out) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
+    size_t slot;
+    return findSailing(sailingID, out, slot);
+}
+
+bool SailingIO::changeVessel(std::string_view sailingID,
+                             const VesselRecord& vessel,
+                             Centimetres hrl,
+                             Centimetres lrl)
+{
+    STATS_SCOPE(SAILING_IO_UPDATE);
     Record temp;
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID)
-            return temp.ppl_on_board;
-    }
-    return -1;
+    size_t slot;
+    if (!findSailing(sailingID, temp, slot)) return false;
+    std::memset(temp.vessel_ID, 0, Sailing::VLEN);
+    std::string_view name = fieldView(vessel.vesselName);
+    std::memcpy(temp.vessel_ID, name.data(), std::min(name.size(), Sailing::VLEN - 1));
+    temp.HRL_cm = hrl;
+    temp.LRL_cm = lrl;
+    writeSailing(slot, temp, vessel.maxPassengers);
+    return static_cast<bool>(fs);
 }
 
-int SailingIO::getVehicleOccupants(const std::string& sailingID) {
-    reset();                        // rewind to file start
+int SailingIO::getPeopleOccupants(std::string_view sailingID) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
+    size_t slot;
+    return findSailing(sailingID, temp, slot) ? temp.ppl_on_board : -1;
+}
+
+int SailingIO::getVehicleOccupants(std::string_view sailingID) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
+    Record temp;
+    size_t slot;
     // scan for the matching sailingID
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            return temp.veh_on_board;   // return occupant count
-        }
-    }
+    if (findSailing(sailingID, temp, slot))
+        return temp.veh_on_board;   // return occupant count
     return -1;                      // not found
 }
 
-bool SailingIO::checkSailingExists(const std::string& sailingID) {
-    reset();                        // rewind to file start
+bool SailingIO::checkSailingExists(std::string_view sailingID) {
+    STATS_SCOPE(SAILING_IO_LOOKUP);
     Record temp;
+    size_t slot;
     // scan for the matching sailingID
-    while (fs.read(reinterpret_cast<char*>(&temp), sizeof temp)) {
-        if (std::string(temp.sailingID) == sailingID) {
-            return true;
+    return findSailing(sailingID, temp, slot);
+}
+
+bool SailingIO::readAllSailings(std::vector<Record>& out) {
+    STATS_SCOPE(SAILING_IO_READ_ALL);
+    if (!file.isOpen()) return false;
+    out.resize(file.slotCount());
+    reset();
+    if (!out.empty()) {
+        bool ok = schema::readRecords(fs, out.data(), out.size());
+        STATS_READ(out.size() * sizeof(Record), out.size());
+        if (!ok) {
+            out.clear();
+            return false;
         }
     }
-    return false;                   // not found
+    return true;
 }
 
 void SailingIO::printSailingReport() {
     // 1) Read all records
-    reset();
     std::vector<Record> recs;
-    Record tmp;
-    while (fs.read(reinterpret_cast<char*>(&tmp), sizeof tmp)) {
-        recs.push_back(tmp);
-    }
+    readAllSailings(recs);
 
     // 2) Chronological sort by DD then HH parsed out of sailingID = "TER-DD-HH"
     auto parse_dt = [](const std::string &sid) {
@@ -353,10 +453,10 @@ void SailingIO::printSailingReport() {
         VesselRecord vRec{};
         float vehPct = 0.0f, pplPct = 0.0f;
         if (VesselIO::readVessel(r.vessel_ID, vRec)) {
-            float totalLane = vRec.highLaneLength + vRec.lowLaneLength;
-            float usedLane  = r.LCU;
+            Centimetres totalLane = vRec.highLaneCm + vRec.lowLaneCm;
+            Centimetres usedLane  = r.LCU_cm;
             vehPct = totalLane > 0
-                     ? (usedLane / totalLane) * 100.0f
+                     ? (static_cast<float>(usedLane) / totalLane) * 100.0f
                      : 0.0f;
             pplPct = vRec.maxPassengers > 0
                      ? (static_cast<float>(totalPeople) / vRec.maxPassengers) * 100.0f
@@ -365,8 +465,8 @@ void SailingIO::printSailingReport() {
 
         // format floats to 2 decimals and append '%'
         std::ostringstream ssLRL, ssHRL, ssVehPct, ssPplPct;
-        ssLRL   << std::fixed << std::setprecision(2) << r.LRL;
-        ssHRL   << std::fixed << std::setprecision(2) << r.HRL;
+        ssLRL   << std::fixed << std::setprecision(2) << toMetres(r.LRL_cm);
+        ssHRL   << std::fixed << std::setprecision(2) << toMetres(r.HRL_cm);
         ssVehPct<< std::fixed << std::setprecision(2) << vehPct << '%';
         ssPplPct<< std::fixed << std::setprecision(2) << pplPct << '%';
 
@@ -392,23 +492,35 @@ void SailingIO::printSailingReport() {
     }
 }
 
+bool SailingIO::flush() {
+    return file.flush();
+}
+
 void SailingIO::close() {
-    fs.close();
+    file.close();
+    ids = BloomFilter();
+    cache.clear();
 }
 
-void SailingIO::printCheckVehicles(const std::string& sailingID) {
-    if (!checkSailingExists(sailingID)) {
-        std::cout << "Sailing ID " << sailingID << " not found.\n";
-        return;
-    }
+void SailingIO::setCacheCapacity(size_t records) {
+    cache.setCapacity(records);
+}
+
+void SailingIO::printCacheReport(std::ostream& out) {
+    cache.printReport(out);
+}
 
+void SailingIO::resetCacheCounters() {
+    cache.resetCounters();
+}
+
+void SailingIO::printCheckVehicles(std::string_view sailingID) {
     // Get sailing record
     Record sailingRec;
-    SailingIO::reset();
-    while (fs.read(reinterpret_cast<char*>(&sailingRec), sizeof(sailingRec))) {
-        if (std::string(sailingRec.sailingID) == sailingID) {
-            break;
-        }
+    size_t slot;
+    if (!findSailing(sailingID, sailingRec, slot)) {
+        std::cout << "Sailing ID " << sailingID << " not found.\n";
+        return;
     }
 
     // Get vessel information
@@ -419,10 +531,10 @@ void SailingIO::printCheckVehicles(const std::string& sailingID) {
     }
 
     // Calculate metrics
-    float totalLaneLength = vesselRec.highLaneLength + vesselRec.lowLaneLength;
-    float usedLaneLength = sailingRec.LCU;
+    Centimetres totalLaneLength = vesselRec.highLaneCm + vesselRec.lowLaneCm;
+    Centimetres usedLaneLength = sailingRec.LCU_cm;
     float lanePercentFull = (totalLaneLength > 0) ? 
-                          (usedLaneLength / totalLaneLength) * 100 : 0;
+                          (static_cast<float>(usedLaneLength) / totalLaneLength) * 100 : 0;
     
     float peoplePercentFull = (vesselRec.maxPassengers > 0) ?
                             (static_cast<float>(sailingRec.ppl_on_board) / vesselRec.maxPassengers) * 100 : 0;
@@ -432,9 +544,9 @@ void SailingIO::printCheckVehicles(const std::string& sailingID) {
     std::cout << std::left << std::setw(25) << "Sailing ID:" << sailingRec.sailingID << "\n";
     std::cout << std::left << std::setw(25) << "Vessel Name:" << sailingRec.vessel_ID << "\n";
     std::cout << std::left << std::setw(25) << "Low Remaining Length:" 
-              << std::fixed << std::setprecision(2) << sailingRec.LRL << " metres\n";
+              << std::fixed << std::setprecision(2) << toMetres(sailingRec.LRL_cm) << " metres\n";
     std::cout << std::left << std::setw(25) << "High Remaining Length:" 
-              << sailingRec.HRL << " metres\n";
+              << toMetres(sailingRec.HRL_cm) << " metres\n";
     std::cout << std::left << std::setw(25) << "Vehicles On Board:" 
               << sailingRec.veh_on_board << "\n";
     std::cout << std::left << std::setw(25) << "Lane Capacity Used:" 
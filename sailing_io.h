@@ -3,17 +3,52 @@
 // sailing_io.h
 // Version History:
 //   1.0 2025-07-20  Initial implementation
+//   1.1 2025-09-01  Sailing record cache controls
+//   1.2 2025-09-02  readSailing and claimLanes for bulk reassignment
+//   1.3 2025-09-02  changeVessel
+//   1.4 2025-09-02  flush
+//   1.5 2025-09-02  open reports failure
+//   1.6 2025-09-02  loadIdFilter
 //============================================================
 #ifndef SAILING_IO_H
 #define SAILING_IO_H
 
+#include <cstddef>
+#include <ostream>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "sailing.h"   // for SailingRecord
+#include "schema.h"
+
+template <>
+struct RecordSchema<Sailing::Record> {
+    static constexpr const char*   NAME    = "sailing";
+    static constexpr uint32_t      VERSION = 2;
+    static constexpr uint32_t      SIZE    = 84;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(Sailing::Record, sailingID,    schema::Type::Text,   0, Sailing::ID_LEN),
+        SCHEMA_FIELD(Sailing::Record, vessel_ID,    schema::Type::Text,  32, Sailing::VLEN),
+        SCHEMA_FIELD(Sailing::Record, HRL_cm,       schema::Type::Int32, 64, 4),
+        SCHEMA_FIELD(Sailing::Record, LRL_cm,       schema::Type::Int32, 68, 4),
+        SCHEMA_FIELD(Sailing::Record, LCU_cm,       schema::Type::Int32, 72, 4),
+        SCHEMA_FIELD(Sailing::Record, ppl_on_board, schema::Type::Int32, 76, 4),
+        SCHEMA_FIELD(Sailing::Record, veh_on_board, schema::Type::Int32, 80, 4),
+    };
+};
+static_assert(schema::layoutMatches<Sailing::Record>(), "Sailing::Record does not match sailings.dat");
+
+struct VesselRecord;
 
 class SailingIO {
 public:
-    /// Open (or create) the binary data file for sailings
-    static void open();
+    /// Open (or create) the binary data file for sailings; false if it
+    /// cannot be opened or its header is rejected
+    static bool open();
+
+    /// Refill the sailing ID filter from AvailabilityTable, which must
+    /// already hold every sailing (restored or rebuilt)
+    static void loadIdFilter();
 
     /// Reset file position to beginning for reads
     static void reset();
@@ -22,58 +57,94 @@ public:
     static bool createSailing(const Sailing::Record& rec);
 
     /// Delete the record matching the given sailing ID, return true if sailing successfull deleted
-    static bool deleteSailing(const std::string& sailingID);
+    static bool deleteSailing(std::string_view sailingID);
+
+    /// Delete every record whose ID is in `sortedIDs` (ascending) with one
+    /// rewrite of the file. Unlike deleteSailing it does not check for
+    /// reservations; the caller must have moved or removed them.
+    static bool removeSailings(const std::vector<std::string>& sortedIDs);
 
     /// Return true if any record’s vessel_ID matches the given name
-    static bool checkSailingsForVessel(const std::string& vesselName);
+    static bool checkSailingsForVessel(std::string_view vesselName);
 
     // update occupants on a sailing
-    static bool updateOccupants(const std::string& sailingID,
+    static bool updateOccupants(std::string_view sailingID,
                                 int numPeople,
-                                float vehicleLength);
+                                Centimetres vehicleLength);
 
     /// Returns true if there is room for one more vehicle
-    static bool checkSailingVehicleCapacity(const std::string& sailingID);
+    static bool checkSailingVehicleCapacity(std::string_view sailingID);
 
     /// Returns true if there is room for `occupants` more people
-    static bool checkSailingPeopleCapacity(const std::string& sailingID,
+    static bool checkSailingPeopleCapacity(std::string_view sailingID,
                                            unsigned int occupants);
 
-    /// Returns true if high‑ceiling lane has ≥ `length` metres free
-    static bool getHighRemLaneLength(const std::string& sailingID,
-                                     float length);
+    /// Returns true if high‑ceiling lane has ≥ `length` cm free
+    static bool getHighRemLaneLength(std::string_view sailingID,
+                                     Centimetres length);
 
-    /// Returns true if low‑ceiling lane has ≥ `length` metres free
-    static bool getLowRemLaneLength(const std::string& sailingID,
-                                    float length);
+    /// Returns true if low‑ceiling lane has ≥ `length` cm free
+    static bool getLowRemLaneLength(std::string_view sailingID,
+                                    Centimetres length);
 
     /**
-     * Subtract `length` metres from the high‑ceiling lane and
+     * Subtract `length` cm from the high‑ceiling lane and
      * remove `occupants` from on_board count for the given sailing.
      */
-    static void updateSailingForHigh(const std::string& sailingID,
-                                     float length);
+    static void updateSailingForHigh(std::string_view sailingID,
+                                     Centimetres length);
 
     /**
-     * Subtract `length` metres from the low‑ceiling lane and
+     * Subtract `length` cm from the low‑ceiling lane and
      * remove `occupants` from on_board count for the given sailing.
      */
-    static void updateSailingForLow(const std::string& sailingID,
-                                    float length);
+    static void updateSailingForLow(std::string_view sailingID,
+                                    Centimetres length);
+
+    /// Subtract `high` and `low` cm (vehicle buffers included) from the
+    /// two lanes with one write; negative lengths give space back
+    static bool claimLanes(std::string_view sailingID,
+                           Centimetres high,
+                           Centimetres low);
+
+    /// Copy the record with this ID into `out`
+    static bool readSailing(std::string_view sailingID, Sailing::Record& out);
+
+    /// Put `vessel` on the sailing with lane remainders `hrl`/`lrl`,
+    /// rewriting its record in place
+    static bool changeVessel(std::string_view sailingID,
+                             const VesselRecord& vessel,
+                             Centimetres hrl,
+                             Centimetres lrl);
 
     /// Return the on_board count for the record with this ID
-    static int getPeopleOccupants(const std::string& sailingID);
+    static int getPeopleOccupants(std::string_view sailingID);
 
-    static int getVehicleOccupants(const std::string& sailingID);
+    static int getVehicleOccupants(std::string_view sailingID);
 
     // checkSailingExists
-    static bool checkSailingExists(const std::string& sailingID);
+    static bool checkSailingExists(std::string_view sailingID);
+
+    /// Read every sailing record into `out` with one sequential pass
+    static bool readAllSailings(std::vector<Sailing::Record>& out);
 
     /// Print all records in a paginated report (e.g., 5 per page)
     static void printSailingReport();
 
     // Print a report with info about vehicles aboard a sailing
-    static void printCheckVehicles(const std::string& sailingID);
+    static void printCheckVehicles(std::string_view sailingID);
+
+    /// Keep at most `records` recently used records in memory (0: none)
+    static void setCacheCapacity(size_t records);
+
+    /// Print the record cache's fill and hit/miss counters
+    static void printCacheReport(std::ostream& out);
+
+    /// Zero the record cache's hit/miss counters
+    static void resetCacheCounters();
+
+    /// Push buffered writes to sailings.dat; true if successful
+    static bool flush();
 
     /// Close the underlying file stream
     static void close();
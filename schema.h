@@ -0,0 +1,330 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// schema.h
+// Description:
+// Compile-time description of the on-disk layout of each record type.
+// A RecordSchema<R> specialisation (next to the IO class that owns the
+// file) lists every field with its byte offset and width in the file.
+// From that list this header derives:
+// - layout checks: layoutMatches<R>() is static_asserted beside each
+//   schema, so reordering, resizing or repacking a member breaks the
+//   build instead of silently changing the data files;
+// - little-endian encode/decode: on little-endian hosts a record is read
+//   straight into the struct (zero copy) and written straight from it
+//   when the layout has no padding; elsewhere fields are copied one by
+//   one with their bytes swapped and padding written as zeros;
+// - field projection: one field read out of an encoded record without
+//   decoding the rest;
+// - hash<R>(): a 64-bit digest of the layout (record name, version,
+//   size and every field's name, type, offset and width) for file
+//   headers to compare when a file is opened.
+//
+// Revision History:
+// Rev. 1 - 2025/08/26 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - project() checks T against the field's type and width
+//*******************************
+
+#ifndef SCHEMA_H
+#define SCHEMA_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+// Specialised once per record type. Each specialisation provides
+//   static constexpr const char*   NAME;      // stable record name
+//   static constexpr uint32_t      VERSION;   // bumped on semantic changes
+//   static constexpr uint32_t      SIZE;      // bytes per record on disk
+//   static constexpr schema::Field FIELDS[];  // in ascending offset order
+template <class Record>
+struct RecordSchema;
+
+namespace schema {
+
+enum class Type : uint8_t {
+    Text,     // NUL-padded bytes, copied as is
+    Int32,    // little-endian two's complement
+    UInt32,   // little-endian
+    Float32,  // little-endian IEEE 754
+    UInt64,   // little-endian
+    Bool      // one byte, 0 or 1
+};
+
+struct Field {
+    const char* name;
+    Type        type;
+    uint32_t    offset;     // byte offset in the file record
+    uint32_t    size;       // byte width in the file record
+    size_t      memOffset;  // offsetof() the member in the struct
+    size_t      memSize;    // sizeof() the member in the struct
+};
+
+// Builds a Field for `member` of `Record`, stored at `offset` with `size`
+// bytes on disk; the in-memory offset and size are taken from the struct
+// so layoutMatches() can compare the two.
+#define SCHEMA_FIELD(Record, member, type, offset, size) \
+    schema::Field{ #member, type, offset, size, offsetof(Record, member), sizeof(Record::member) }
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+constexpr bool HOST_LITTLE_ENDIAN = false;
+#else
+constexpr bool HOST_LITTLE_ENDIAN = true;
+#endif
+
+template <class R>
+constexpr size_t fieldCount() {
+    return sizeof(RecordSchema<R>::FIELDS) / sizeof(Field);
+}
+
+// Width of one element; numeric fields may be arrays of several elements
+constexpr uint32_t widthOf(Type type) {
+    return type == Type::Bool   ? 1
+         : type == Type::Text   ? 1
+         : type == Type::UInt64 ? 8
+         : 4;
+}
+
+//------
+// Description:
+// True if the struct matches its file layout: same total size, every
+// field at its file offset with its file width, fields in order and
+// non-overlapping, and the struct safe to copy byte for byte.
+// Precondition:
+// None
+template <class R>
+constexpr bool layoutMatches() {
+    using S = RecordSchema<R>;
+    if (!std::is_trivially_copyable<R>::value || sizeof(R) != S::SIZE) return false;
+    uint32_t end = 0;
+    for (size_t i = 0; i < fieldCount<R>(); ++i) {
+        const Field& f = S::FIELDS[i];
+        if (f.offset < end || f.offset + f.size > S::SIZE) return false;
+        if (f.memOffset != f.offset || f.memSize != f.size) return false;
+        if (f.size == 0 || f.size % widthOf(f.type) != 0) return false;
+        end = f.offset + f.size;
+    }
+    return true;
+}
+
+//------
+// Description:
+// True if the fields cover every byte of the record (no padding).
+// Precondition:
+// None
+template <class R>
+constexpr bool isDense() {
+    uint32_t covered = 0;
+    for (size_t i = 0; i < fieldCount<R>(); ++i) covered += RecordSchema<R>::FIELDS[i].size;
+    return covered == RecordSchema<R>::SIZE;
+}
+
+namespace detail {
+    constexpr uint64_t FNV_OFFSET = 1469598103934665603ull;
+    constexpr uint64_t FNV_PRIME  = 1099511628211ull;
+
+    constexpr uint64_t mix(uint64_t h, uint64_t v, int bytes) {
+        for (int i = 0; i < bytes; ++i) {
+            h ^= (v >> (8 * i)) & 0xff;
+            h *= FNV_PRIME;
+        }
+        return h;
+    }
+
+    constexpr uint64_t mix(uint64_t h, const char* text) {
+        for (; *text; ++text) h = mix(h, static_cast<unsigned char>(*text), 1);
+        return mix(h, 0, 1);
+    }
+
+    // True if a T can hold one field of type `t`
+    template <class T>
+    constexpr bool holds(Type t) {
+        switch (t) {
+            case Type::Int32:   return std::is_integral<T>::value && std::is_signed<T>::value
+                                    && sizeof(T) == 4;
+            case Type::UInt32:  return std::is_integral<T>::value && std::is_unsigned<T>::value
+                                    && sizeof(T) == 4;
+            case Type::Float32: return std::is_same<T, float>::value;
+            case Type::UInt64:  return std::is_integral<T>::value && std::is_unsigned<T>::value
+                                    && sizeof(T) == 8;
+            case Type::Bool:    return std::is_same<T, bool>::value;
+            case Type::Text:    return false;
+        }
+        return false;
+    }
+
+    inline void copyField(char* dst, const char* src, const Field& f, bool swap) {
+        const uint32_t w = widthOf(f.type);
+        if (swap && w > 1) {
+            for (uint32_t e = 0; e < f.size; e += w)
+                for (uint32_t i = 0; i < w; ++i) dst[e + i] = src[e + w - 1 - i];
+        } else {
+            std::memcpy(dst, src, f.size);
+        }
+    }
+}
+
+//------
+// Description:
+// FNV-1a digest of the record layout. Any change to a field's name, type,
+// offset or width, to the record size or to the schema version changes it.
+// Precondition:
+// None
+template <class R>
+constexpr uint64_t hash() {
+    using S = RecordSchema<R>;
+    uint64_t h = detail::mix(detail::FNV_OFFSET, S::NAME);
+    h = detail::mix(h, S::VERSION, 4);
+    h = detail::mix(h, S::SIZE, 4);
+    for (size_t i = 0; i < fieldCount<R>(); ++i) {
+        const Field& f = S::FIELDS[i];
+        h = detail::mix(h, f.name);
+        h = detail::mix(h, static_cast<uint8_t>(f.type), 1);
+        h = detail::mix(h, f.offset, 4);
+        h = detail::mix(h, f.size, 4);
+    }
+    return h;
+}
+
+//------
+// Description:
+// Index of the field called `name`, or fieldCount<R>() if there is none.
+// Precondition:
+// None
+template <class R>
+constexpr size_t fieldIndex(std::string_view name) {
+    for (size_t i = 0; i < fieldCount<R>(); ++i)
+        if (std::string_view(RecordSchema<R>::FIELDS[i].name) == name) return i;
+    return fieldCount<R>();
+}
+
+//------
+// Description:
+// Writes `rec` in file layout to `out` (RecordSchema<R>::SIZE bytes).
+// Padding bytes are written as zeros.
+// Precondition:
+// None
+template <class R>
+inline void encode(const R& rec, char* out) {
+    const char* src = reinterpret_cast<const char*>(&rec);
+    if (HOST_LITTLE_ENDIAN && isDense<R>()) {
+        std::memcpy(out, src, RecordSchema<R>::SIZE);
+        return;
+    }
+    std::memset(out, 0, RecordSchema<R>::SIZE);
+    for (size_t i = 0; i < fieldCount<R>(); ++i) {
+        const Field& f = RecordSchema<R>::FIELDS[i];
+        detail::copyField(out + f.offset, src + f.memOffset, f, !HOST_LITTLE_ENDIAN);
+    }
+}
+
+//------
+// Description:
+// Reads a record in file layout from `in` into `rec`.
+// Precondition:
+// `in` holds RecordSchema<R>::SIZE bytes
+template <class R>
+inline void decode(const char* in, R& rec) {
+    char* dst = reinterpret_cast<char*>(&rec);
+    if (HOST_LITTLE_ENDIAN) {
+        std::memcpy(dst, in, RecordSchema<R>::SIZE);
+        return;
+    }
+    for (size_t i = 0; i < fieldCount<R>(); ++i) {
+        const Field& f = RecordSchema<R>::FIELDS[i];
+        detail::copyField(dst + f.memOffset, in + f.offset, f, true);
+    }
+}
+
+//------
+// Description:
+// Reads one record from the stream's get position. Returns the stream
+// state, so it can drive the same loops as istream::read.
+// Precondition:
+// None
+template <class R>
+inline bool readRecord(std::istream& in, R& rec) {
+    if (HOST_LITTLE_ENDIAN)
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&rec), RecordSchema<R>::SIZE));
+    char buf[RecordSchema<R>::SIZE];
+    if (!in.read(buf, sizeof buf)) return false;
+    decode(buf, rec);
+    return true;
+}
+
+//------
+// Description:
+// Reads `n` consecutive records in a single stream read.
+// Precondition:
+// `out` has room for n records
+template <class R>
+inline bool readRecords(std::istream& in, R* out, size_t n) {
+    char* dst = reinterpret_cast<char*>(out);
+    if (!in.read(dst, static_cast<std::streamsize>(n * RecordSchema<R>::SIZE))) return false;
+    if (!HOST_LITTLE_ENDIAN) {
+        // decode in place, one record at a time from a copy of its bytes
+        char buf[RecordSchema<R>::SIZE];
+        for (size_t i = 0; i < n; ++i) {
+            std::memcpy(buf, dst + i * sizeof buf, sizeof buf);
+            decode(buf, out[i]);
+        }
+    }
+    return true;
+}
+
+//------
+// Description:
+// Writes one record at the stream's put position. Returns the stream state.
+// Precondition:
+// None
+template <class R>
+inline bool writeRecord(std::ostream& out, const R& rec) {
+    if (HOST_LITTLE_ENDIAN && isDense<R>())
+        return static_cast<bool>(out.write(reinterpret_cast<const char*>(&rec), RecordSchema<R>::SIZE));
+    char buf[RecordSchema<R>::SIZE];
+    encode(rec, buf);
+    return static_cast<bool>(out.write(buf, sizeof buf));
+}
+
+//------
+// Description:
+// Projects numeric field `index` out of an encoded record. A T that
+// does not match the field's type and width asserts, and in release
+// builds yields T() rather than copying the field over a smaller T.
+// Precondition:
+// T is the field's type (int32_t, uint32_t, float, uint64_t or bool)
+template <class R, class T>
+inline T project(const char* encoded, size_t index) {
+    static_assert(std::is_arithmetic<T>::value, "text fields use projectText");
+    const Field& f = RecordSchema<R>::FIELDS[index];
+    const bool fits = detail::holds<T>(f.type) && sizeof(T) == f.size;
+    assert(fits && "project<R, T>: T does not match the field");
+    T value{};
+    if (!fits) return value;
+    detail::copyField(reinterpret_cast<char*>(&value), encoded + f.offset, f,
+                      !HOST_LITTLE_ENDIAN);
+    return value;
+}
+
+//------
+// Description:
+// Projects text field `index` out of an encoded record. The view points
+// into `encoded` and stops at the first NUL.
+// Precondition:
+// Field `index` is Type::Text
+template <class R>
+inline std::string_view projectText(const char* encoded, size_t index) {
+    const Field& f = RecordSchema<R>::FIELDS[index];
+    const char* text = encoded + f.offset;
+    return std::string_view(text, strnlen(text, f.size));
+}
+
+} // namespace schema
+
+#endif // SCHEMA_H
@@ -0,0 +1,312 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// stats.cpp
+// Description:
+// Implementation of the Stats class. Each thread owns one block of
+// counters; the owner is the only writer, so updates are plain relaxed
+// load/store pairs with no locking. A registry of live blocks (plus one
+// block holding the totals of threads that have exited) is merged when a
+// summary is requested.
+//
+// Latencies go into a log-linear histogram: 16 linear sub-buckets per
+// power of two, which keeps every percentile within about 6%.
+//
+// Revision History:
+// Rev. 1 - 2025/08/18 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Flushes and fsyncs reported apart
+//*******************************
+
+#include "stats.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::atomic<bool> Stats::enabled{false};
+
+namespace {
+    const int SUB_BITS    = 4;
+    const int SUB_BUCKETS = 1 << SUB_BITS;
+    const int NUM_BUCKETS = 64 * SUB_BUCKETS;
+
+    const char* const OP_NAMES[Stats::NUM_OPS] = {
+        "SailingIO::create",
+        "SailingIO::delete",
+        "SailingIO::lookup",
+        "SailingIO::update",
+        "SailingIO::readAll",
+        "VesselIO::create",
+        "VesselIO::delete",
+        "VesselIO::read",
+        "VesselIO::readAll",
+        "VehicleIO::create",
+        "VehicleIO::lookup",
+        "ReservationIO::create",
+        "ReservationIO::delete",
+        "ReservationIO::update",
+        "ReservationIO::lookup",
+        "ReservationIO::readAll",
+        "Vessel::createVessel",
+        "Vessel::deleteVessel",
+        "Sailing::createSailing",
+        "Sailing::deleteSailing",
+        "Reservation::create",
+        "Reservation::createSpecial",
+        "Reservation::cancel",
+        "Reservation::logArrivals",
+        "Reservation::rebook",
+        "Reassignment::cancelSailing",
+        "Reassignment::substituteVessel",
+        "Reassignment::makeLaneRoom",
+        "Archive::archiveBefore",
+        "Archive::lookup",
+    };
+
+    using Counter = std::atomic<uint64_t>;
+
+    struct OpCounters {
+        Counter calls{0};
+        Counter recordsScanned{0};
+        Counter readCalls{0};
+        Counter bytesRead{0};
+        Counter writeCalls{0};
+        Counter bytesWritten{0};
+        Counter flushes{0};
+        Counter fsyncs{0};
+        Counter totalNs{0};
+        Counter maxNs{0};
+        Counter histogram[NUM_BUCKETS];
+
+        OpCounters() { for (auto& b : histogram) b.store(0, std::memory_order_relaxed); }
+    };
+
+    struct ThreadStats {
+        OpCounters ops[Stats::NUM_OPS];
+        int current = -1;   // innermost active Scope on this thread
+    };
+
+    // Single-writer increment: only the owning thread (or the registry under
+    // its lock) ever writes a counter, so no read-modify-write is needed.
+    inline void bump(Counter& c, uint64_t n) {
+        c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    inline uint64_t get(const Counter& c) {
+        return c.load(std::memory_order_relaxed);
+    }
+
+    int bucketFor(uint64_t v) {
+        if (v < static_cast<uint64_t>(SUB_BUCKETS)) return static_cast<int>(v);
+        int msb   = 63 - __builtin_clzll(v);
+        int shift = msb - SUB_BITS;
+        return (shift + 1) * SUB_BUCKETS + static_cast<int>((v >> shift) & (SUB_BUCKETS - 1));
+    }
+
+    uint64_t bucketValue(int b) {
+        if (b < SUB_BUCKETS) return static_cast<uint64_t>(b);
+        int shift = b / SUB_BUCKETS - 1;
+        uint64_t sub = static_cast<uint64_t>(b % SUB_BUCKETS);
+        return (uint64_t(1) << (shift + SUB_BITS)) | (sub << shift);
+    }
+
+    std::mutex registryMutex;
+    std::vector<ThreadStats*> liveThreads;
+    ThreadStats retired;   // totals of threads that have exited
+
+    void addInto(OpCounters& dst, const OpCounters& src) {
+        bump(dst.calls,          get(src.calls));
+        bump(dst.recordsScanned, get(src.recordsScanned));
+        bump(dst.readCalls,      get(src.readCalls));
+        bump(dst.bytesRead,      get(src.bytesRead));
+        bump(dst.writeCalls,     get(src.writeCalls));
+        bump(dst.bytesWritten,   get(src.bytesWritten));
+        bump(dst.flushes,        get(src.flushes));
+        bump(dst.fsyncs,         get(src.fsyncs));
+        bump(dst.totalNs,        get(src.totalNs));
+        dst.maxNs.store(std::max(get(dst.maxNs), get(src.maxNs)), std::memory_order_relaxed);
+        for (int b = 0; b < NUM_BUCKETS; ++b) bump(dst.histogram[b], get(src.histogram[b]));
+    }
+
+    void clear(OpCounters& c) {
+        for (Counter* f : {&c.calls, &c.recordsScanned, &c.readCalls, &c.bytesRead,
+                           &c.writeCalls, &c.bytesWritten, &c.flushes, &c.fsyncs,
+                           &c.totalNs, &c.maxNs})
+            f->store(0, std::memory_order_relaxed);
+        for (auto& b : c.histogram) b.store(0, std::memory_order_relaxed);
+    }
+
+    // Registers this thread's block on first use and folds it into
+    // `retired` when the thread exits.
+    struct ThreadHolder {
+        ThreadStats* stats;
+        ThreadHolder() : stats(new ThreadStats) {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            liveThreads.push_back(stats);
+        }
+        ~ThreadHolder() {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            for (int op = 0; op < Stats::NUM_OPS; ++op) addInto(retired.ops[op], stats->ops[op]);
+            liveThreads.erase(std::remove(liveThreads.begin(), liveThreads.end(), stats),
+                              liveThreads.end());
+            delete stats;
+        }
+    };
+
+    ThreadStats& local() {
+        thread_local ThreadHolder holder;
+        return *holder.stats;
+    }
+
+    OpCounters* currentOp() {
+        ThreadStats& ts = local();
+        return ts.current < 0 ? nullptr : &ts.ops[ts.current];
+    }
+}
+
+void Stats::setEnabled(bool on) {
+    enabled.store(on, std::memory_order_relaxed);
+}
+
+void Stats::initFromEnvironment() {
+    const char* env = std::getenv("SETSAIL_STATS");
+    if (env && *env && std::string(env) != "0") setEnabled(true);
+}
+
+void Stats::reset() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (int op = 0; op < NUM_OPS; ++op) {
+        clear(retired.ops[op]);
+        for (ThreadStats* ts : liveThreads) clear(ts->ops[op]);
+    }
+}
+
+const char* Stats::opName(Op op) {
+    return OP_NAMES[op];
+}
+
+void Stats::recordRead(uint64_t bytes, uint64_t records) {
+    if (OpCounters* c = currentOp()) {
+        bump(c->readCalls, 1);
+        bump(c->bytesRead, bytes);
+        bump(c->recordsScanned, records);
+    }
+}
+
+void Stats::recordWrite(uint64_t bytes) {
+    if (OpCounters* c = currentOp()) {
+        bump(c->writeCalls, 1);
+        bump(c->bytesWritten, bytes);
+    }
+}
+
+void Stats::recordFlush() {
+    if (OpCounters* c = currentOp()) bump(c->flushes, 1);
+}
+
+void Stats::recordFsync() {
+    if (OpCounters* c = currentOp()) bump(c->fsyncs, 1);
+}
+
+Stats::Scope::Scope(Op op)
+    : op(op), previous(-1), active(Stats::isEnabled())
+{
+    if (!active) return;
+    ThreadStats& ts = local();
+    previous   = ts.current;
+    ts.current = op;
+    start      = std::chrono::steady_clock::now();
+}
+
+Stats::Scope::~Scope() {
+    if (!active) return;
+    uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start).count());
+    ThreadStats& ts = local();
+    OpCounters& c = ts.ops[op];
+    bump(c.calls, 1);
+    bump(c.totalNs, ns);
+    if (ns > get(c.maxNs)) c.maxNs.store(ns, std::memory_order_relaxed);
+    bump(c.histogram[bucketFor(ns)], 1);
+    ts.current = previous;
+}
+
+Stats::Summary Stats::summarize(Op op) {
+    OpCounters merged;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        addInto(merged, retired.ops[op]);
+        for (ThreadStats* ts : liveThreads) addInto(merged, ts->ops[op]);
+    }
+
+    Summary s;
+    s.calls          = get(merged.calls);
+    s.recordsScanned = get(merged.recordsScanned);
+    s.readCalls      = get(merged.readCalls);
+    s.bytesRead      = get(merged.bytesRead);
+    s.writeCalls     = get(merged.writeCalls);
+    s.bytesWritten   = get(merged.bytesWritten);
+    s.flushes        = get(merged.flushes);
+    s.fsyncs         = get(merged.fsyncs);
+    s.totalNs        = get(merged.totalNs);
+    s.maxNs          = get(merged.maxNs);
+
+    uint64_t count = 0, p50At = (s.calls + 1) / 2, p99At = (s.calls * 99 + 99) / 100;
+    for (int b = 0; b < NUM_BUCKETS && count < s.calls; ++b) {
+        uint64_t n = get(merged.histogram[b]);
+        if (n == 0) continue;
+        if (count < p50At && count + n >= p50At) s.p50Ns = bucketValue(b);
+        if (count < p99At && count + n >= p99At) s.p99Ns = bucketValue(b);
+        count += n;
+    }
+    return s;
+}
+
+void Stats::printReport(std::ostream& out) {
+    const int w1 = 28, w2 = 8, w3 = 11, w4 = 9, w5 = 10, w6 = 8, w7 = 10, w8 = 8,
+              w9 = 7, w10 = 11, w11 = 11, w12 = 11, w13 = 11;
+    std::ios::fmtflags oldFlags = out.flags();
+    out << std::left
+        << std::setw(w1) << "Operation"
+        << std::right
+        << std::setw(w2) << "Calls"
+        << std::setw(w3) << "Scanned"
+        << std::setw(w4) << "Reads"
+        << std::setw(w5) << "KBRead"
+        << std::setw(w6) << "Writes"
+        << std::setw(w7) << "KBWrite"
+        << std::setw(w8) << "Flushes"
+        << std::setw(w9) << "Fsyncs"
+        << std::setw(w10) << "Mean(us)"
+        << std::setw(w11) << "P50(us)"
+        << std::setw(w12) << "P99(us)"
+        << std::setw(w13) << "Max(us)"
+        << "\n"
+        << std::string(w1+w2+w3+w4+w5+w6+w7+w8+w9+w10+w11+w12+w13, '=') << "\n"
+        << std::fixed << std::setprecision(1);
+
+    for (int op = 0; op < NUM_OPS; ++op) {
+        Summary s = summarize(static_cast<Op>(op));
+        if (s.calls == 0) continue;
+        out << std::left
+            << std::setw(w1) << OP_NAMES[op]
+            << std::right
+            << std::setw(w2) << s.calls
+            << std::setw(w3) << s.recordsScanned
+            << std::setw(w4) << s.readCalls
+            << std::setw(w5) << s.bytesRead / 1024.0
+            << std::setw(w6) << s.writeCalls
+            << std::setw(w7) << s.bytesWritten / 1024.0
+            << std::setw(w8) << s.flushes
+            << std::setw(w9) << s.fsyncs
+            << std::setw(w10) << s.totalNs / 1000.0 / s.calls
+            << std::setw(w11) << s.p50Ns / 1000.0
+            << std::setw(w12) << s.p99Ns / 1000.0
+            << std::setw(w13) << s.maxNs / 1000.0
+            << "\n";
+    }
+    out.flags(oldFlags);
+}
@@ -0,0 +1,175 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// stats.h
+// Description:
+// Low-overhead instrumentation for the storage and domain layers. Each
+// operation records its call count, latency (log-linear histogram),
+// records scanned, read/write calls, bytes moved, stream flushes and
+// fsyncs. A flush only hands buffered bytes to the OS; an fsync is what
+// makes them durable, so the two are counted apart. Counters are kept
+// per thread and merged only when a report is requested.
+//
+// Collection is off at run time until Stats::setEnabled(true) is called
+// (or SETSAIL_STATS=1 is set in the environment at startup). Building with
+// -DSETSAIL_NO_STATS removes the instrumentation entirely.
+//
+// Revision History:
+// Rev. 1 - 2025/08/18 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Flushes and fsyncs counted apart
+//*******************************
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+class Stats {
+public:
+    // Instrumented operations. Keep in step with the names in stats.cpp.
+    enum Op {
+        SAILING_IO_CREATE,
+        SAILING_IO_DELETE,
+        SAILING_IO_LOOKUP,
+        SAILING_IO_UPDATE,
+        SAILING_IO_READ_ALL,
+        VESSEL_IO_CREATE,
+        VESSEL_IO_DELETE,
+        VESSEL_IO_READ,
+        VESSEL_IO_READ_ALL,
+        VEHICLE_IO_CREATE,
+        VEHICLE_IO_LOOKUP,
+        RESERVATION_IO_CREATE,
+        RESERVATION_IO_DELETE,
+        RESERVATION_IO_UPDATE,
+        RESERVATION_IO_LOOKUP,
+        RESERVATION_IO_READ_ALL,
+        CREATE_VESSEL,
+        DELETE_VESSEL,
+        CREATE_SAILING,
+        DELETE_SAILING,
+        CREATE_RESERVATION,
+        CREATE_SPECIAL_RESERVATION,
+        CANCEL_RESERVATION,
+        LOG_ARRIVALS,
+        REBOOK_RESERVATION,
+        CANCEL_SAILING,
+        SUBSTITUTE_VESSEL,
+        MAKE_LANE_ROOM,
+        ARCHIVE_SAILINGS,
+        ARCHIVE_LOOKUP,
+        NUM_OPS
+    };
+
+    // Merged figures for one operation
+    struct Summary {
+        uint64_t calls          = 0;
+        uint64_t recordsScanned = 0;
+        uint64_t readCalls      = 0;
+        uint64_t bytesRead      = 0;
+        uint64_t writeCalls     = 0;
+        uint64_t bytesWritten   = 0;
+        uint64_t flushes        = 0;
+        uint64_t fsyncs         = 0;
+        uint64_t totalNs        = 0;
+        uint64_t p50Ns          = 0;
+        uint64_t p99Ns          = 0;
+        uint64_t maxNs          = 0;
+    };
+
+    //------
+    // Description:
+    // Turns collection on or off at run time.
+    // Precondition:
+    // None
+    static void setEnabled(bool on);
+
+    //------
+    // Description:
+    // Returns true if collection is on.
+    // Precondition:
+    // None
+    static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+    //------
+    // Description:
+    // Enables collection if the SETSAIL_STATS environment variable is set
+    // to a non-zero value.
+    // Precondition:
+    // None
+    static void initFromEnvironment();
+
+    //------
+    // Description:
+    // Clears the counters of every thread.
+    // Precondition:
+    // None
+    static void reset();
+
+    //------
+    // Description:
+    // Merges all thread-local counters for one operation.
+    // Precondition:
+    // None
+    static Summary summarize(Op op);
+
+    //------
+    // Description:
+    // Prints a table of every operation that has been called.
+    // Precondition:
+    // None
+    static void printReport(std::ostream& out);
+
+    //------
+    // Description:
+    // Returns the printable name of an operation.
+    // Precondition:
+    // op < NUM_OPS
+    static const char* opName(Op op);
+
+    // Counters attributed to the innermost active scope on this thread
+    static void recordRead(uint64_t bytes, uint64_t records = 1);  // one read call
+    static void recordWrite(uint64_t bytes);                       // one write call
+    static void recordFlush();                                     // one stream flush
+    static void recordFsync();                                     // one fsync
+
+    // Times one operation from construction to destruction
+    class Scope {
+    public:
+        explicit Scope(Op op);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Op   op;
+        int  previous;
+        bool active;
+        std::chrono::steady_clock::time_point start;
+    };
+
+private:
+    static std::atomic<bool> enabled;
+};
+
+#ifdef SETSAIL_NO_STATS
+#define STATS_SCOPE(op)       ((void)0)
+#define STATS_READ(...)       ((void)0)
+#define STATS_WRITE(bytes)    ((void)0)
+#define STATS_FLUSH()         ((void)0)
+#define STATS_FSYNC()         ((void)0)
+#else
+#define STATS_CONCAT_(a, b)   a##b
+#define STATS_CONCAT(a, b)    STATS_CONCAT_(a, b)
+#define STATS_SCOPE(op)       Stats::Scope STATS_CONCAT(statsScope_, __LINE__)(Stats::op)
+#define STATS_READ(...)       do { if (Stats::isEnabled()) Stats::recordRead(__VA_ARGS__); } while (0)
+#define STATS_WRITE(bytes)    do { if (Stats::isEnabled()) Stats::recordWrite(bytes); } while (0)
+#define STATS_FLUSH()         do { if (Stats::isEnabled()) Stats::recordFlush(); } while (0)
+#define STATS_FSYNC()         do { if (Stats::isEnabled()) Stats::recordFsync(); } while (0)
+#endif
+
+#endif // STATS_H
@@ -0,0 +1,141 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// archive.cpp
+// Description:
+// Moves departed sailings and their reservations from a data directory
+// into its archive.dat (see archive.h), and reads the archive back.
+//
+// --before DD archives every departed sailing (all bookings checked in)
+// of the days before DD. --report prints every archived
+// sailing with its bookings and fares; --sailing ID prints one archived
+// sailing and its reservations. With no option the archive is only
+// summarised.
+//
+// Usage:
+//   make archive
+//   build/setsail_archive [--before DD] [--report] [--sailing ID] [DIR]
+//
+// Revision History:
+// Rev. 1 - 2025/08/30 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - --today removed
+// Rev. 3 - 2025/09/02 - Team 12
+// - Stops if a data file cannot be opened
+// Rev. 4 - 2025/09/02 - Team 12
+// - Reservations printed through Reservation::fields, not as a friend
+//*******************************
+
+#include "../archive.h"
+#include "../vessel.h"
+#include "../sailing.h"
+#include "../reservation.h"
+#include "../vehicle.h"
+#include "../keys.h"
+
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct Options {
+        int         before = 0;      // 0: do not archive
+        bool        report = false;
+        std::string sailingID;
+        std::string dataDir = ".";
+    };
+
+    bool parseArgs(int argc, char** argv, Options& opts) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--report") {
+                opts.report = true;
+            } else if (arg == "--before" || arg == "--sailing") {
+                if (i + 1 >= argc) {
+                    std::cerr << "Missing value for " << arg << "\n";
+                    return false;
+                }
+                std::string v = argv[++i];
+                if (arg == "--before") opts.before = std::atoi(v.c_str());
+                else                   opts.sailingID = v;
+            } else if (arg.rfind("--", 0) == 0) {
+                std::cerr << "Unknown option " << arg << "\n";
+                return false;
+            } else {
+                opts.dataDir = arg;
+            }
+        }
+        return true;
+    }
+
+    // Prints one archived sailing and its reservations
+    void printSailing(const std::string& id) {
+        Sailing::Record rec;
+        std::vector<Reservation> reservations;
+        if (!Archive::findSailing(id, rec) || !Archive::readReservations(id, reservations)) {
+            std::cout << id << " is not archived\n";
+            return;
+        }
+        std::cout << fieldView(rec.sailingID) << " on " << fieldView(rec.vessel_ID)
+                  << ": " << rec.ppl_on_board << " people, "
+                  << rec.veh_on_board << " vehicles, "
+                  << reservations.size() << " reservations\n"
+                  << std::fixed << std::setprecision(2);
+        for (const Reservation& res : reservations) {
+            const Reservation::Fields f = res.fields();
+            std::cout << "  " << std::left << std::setw(12) << f.license
+                      << std::setw(10) << f.fare
+                      << (f.checkedIn ? "checked in" : "") << "\n";
+        }
+    }
+}
+
+//------
+// Description:
+// Parses options, archives if asked, then reports on the archive.
+int main(int argc, char** argv) {
+    Options opts;
+    if (!parseArgs(argc, argv, opts)) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--before DD] [--report] [--sailing ID] [DIR]\n";
+        return 1;
+    }
+    std::error_code ec;
+    std::filesystem::current_path(opts.dataDir, ec);
+    if (ec) {
+        std::cerr << "Error: cannot enter " << opts.dataDir << ": " << ec.message() << "\n";
+        return 1;
+    }
+
+    bool ok = true;
+    if (opts.before > 0) {
+        if (!Vessel::init() || !Sailing::init() || !Reservation::init() || !Vehicle::init()) {
+            std::cerr << "Error: cannot open the data files in " << opts.dataDir << "\n";
+            return 1;
+        }
+        Archive::Moved moved;
+        ok = Archive::archiveBefore(opts.before, moved);
+        std::cout << "Archived " << moved.sailings << " sailings and "
+                  << moved.reservations << " reservations departing before day "
+                  << opts.before << "\n";
+        Sailing::shutdown();
+        Reservation::shutdown();
+        Vehicle::shutdown();
+        Vessel::shutdown();
+    }
+
+    if (opts.report) Archive::printArchiveReport(std::cout);
+    if (!opts.sailingID.empty()) printSailing(opts.sailingID);
+    if (!opts.report && opts.sailingID.empty()) {
+        std::vector<Sailing::Record> sailings;
+        std::vector<Reservation> reservations;
+        ok = Archive::readSailings(sailings) && Archive::readAllReservations(reservations) && ok;
+        std::cout << "archive.dat holds " << sailings.size() << " sailings and "
+                  << reservations.size() << " reservations\n";
+    }
+    Archive::close();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,370 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// gen_data.cpp
+// Description:
+// Deterministic synthetic data generator. Writes vessels.dat, sailings.dat,
+// vehicles.dat and the per-day reservation shards (reservations-DD.dat)
+// directly in their on-disk formats (RecordFile header followed by the
+// records), appending a block at a time through RecordAppender. The same
+// seed and options always produce the same files.
+//
+// The generated data keeps the invariants the engine relies on:
+// - each sailing starts from its vessel's lane lengths; every reservation
+//   takes (length + 50 cm) off the lane it was placed in, using the same
+//   lane choice as Reservation::createSpecialReservation
+// - booked passengers never exceed the vessel's maxPassengers
+// - checked-in reservations are reflected in LCU, ppl_on_board and
+//   veh_on_board exactly as Sailing::updateOccupants would leave them
+// - fares are 14.0 for regular vehicles, length x 2 (low) or x 3 (high)
+//   for special vehicles
+// - a vehicle is booked at most once per sailing
+//
+// Usage:
+//   make gen
+//   build/setsail_gen [--out DIR] [--seed N] [--vessels N] [--sailings N]
+//                     [--vehicles N] [--reservations N]
+//                     [--special-share F] [--tall-share F]
+//                     [--min-height M] [--max-height M]
+//                     [--min-length M] [--max-length M]
+//                     [--max-occupants N] [--lane-fill F] [--checkin-share F]
+//
+// Revision History:
+// Rev. 1 - 2025/08/16 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/08/25 - Team 12
+// - Lane lengths and vehicle dimensions written in centimetres
+// Rev. 3 - 2025/08/27 - Team 12
+// - Files start with a RecordFile header
+// Rev. 4 - 2025/08/29 - Team 12
+// - Reservations written to per-day shards
+// Rev. 5 - 2025/08/31 - Team 12
+// - Records appended in blocks (RecordAppender)
+// Rev. 6 - 2025/09/02 - Team 12
+// - Reservations built with Reservation::fromFields
+//*******************************
+
+#include "../sailing_io.h"
+#include "../vessel_io.h"
+#include "../vehicle_io.h"
+#include "../reservation_io.h"
+#include "../record_file.h"
+#include "../record_block.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    const Centimetres VEHICLE_BUF     = Sailing::VEHICLE_BUF_CM;
+    const Centimetres REGULAR_LENGTH  = Reservation::REGULAR_LENGTH_CM;
+    const Centimetres LOW_LANE_HEIGHT = Reservation::LOW_LANE_HEIGHT_CM;
+    const float       REGULAR_FARE    = 14.0f;
+    const int   SLOTS_PER_TERMINAL = 31 * 24;  // DD x HH combinations
+
+    struct Options {
+        std::string   outDir        = ".";
+        unsigned long seed          = 276;
+        size_t        vessels       = 200;
+        size_t        sailings      = 20000;
+        size_t        vehicles      = 1000000;
+        size_t        reservations  = 1000000;
+        double        specialShare  = 0.15;  // share of vehicles that are special
+        double        tallShare     = 0.6;   // share of special vehicles over 2 m
+        float         minHeight     = 2.1f;  // tall special vehicle height range
+        float         maxHeight     = 4.5f;
+        float         minLength     = 7.5f;  // long special vehicle length range
+        float         maxLength     = 25.0f;
+        int           maxOccupants  = 6;
+        double        laneFill      = 0.75;  // mean fraction of lane metres booked
+        double        checkinShare  = 0.3;   // share of reservations checked in
+    };
+
+    struct VehicleSpec {
+        Centimetres height;
+        Centimetres length;
+        bool        special;
+    };
+}
+
+//------
+// Description:
+// Produces the four data files from the options. Friend of Reservation so
+// it can build reservation records without going through the domain checks.
+class DataGenerator {
+public:
+    explicit DataGenerator(const Options& opts) : opts(opts), rng(opts.seed) {}
+
+    bool run() {
+        std::filesystem::create_directories(opts.outDir);
+        return writeVessels() && writeVehicles() && writeSailingsAndReservations();
+    }
+
+private:
+    const Options&  opts;
+    std::mt19937_64 rng;
+    std::vector<VesselRecord> vessels;
+    std::vector<VehicleSpec>  fleet;
+
+    double uniform(double lo, double hi) {
+        return std::uniform_real_distribution<double>(lo, hi)(rng);
+    }
+
+    size_t pick(size_t n) {
+        return std::uniform_int_distribution<size_t>(0, n - 1)(rng);
+    }
+
+    bool chance(double p) {
+        return std::bernoulli_distribution(p)(rng);
+    }
+
+    // Round a length in metres to whole centimetres.
+    static Centimetres centimetres(double metres) {
+        return static_cast<Centimetres>(metres * 100.0 + 0.5);
+    }
+
+    std::string path(const std::string& file) const {
+        return (std::filesystem::path(opts.outDir) / file).string();
+    }
+
+    // An empty data file of R records at `file`, open for appending
+    template <class R>
+    std::unique_ptr<RecordFile> createFile(const std::string& file) const {
+        std::string full = path(file);
+        auto out = std::make_unique<RecordFile>(full.c_str(), RecordFile::formatOf<R>());
+        if (!out->recreate()) return nullptr;
+        return out;
+    }
+
+    bool writeVessels() {
+        auto file = createFile<VesselRecord>("vessels.dat");
+        if (!file) return false;
+        RecordAppender<VesselRecord> out(*file);
+        vessels.resize(opts.vessels);
+        for (size_t i = 0; i < opts.vessels; ++i) {
+            VesselRecord& rec = vessels[i];
+            std::memset(&rec, 0, sizeof rec);
+            std::snprintf(rec.vesselName, sizeof rec.vesselName, "Vessel-%04zu", i);
+            rec.maxPassengers  = static_cast<int>(uniform(400, 3600));
+            rec.highLaneCm     = centimetres(uniform(100, 1200));
+            rec.lowLaneCm      = centimetres(uniform(300, 2400));
+            if (!out.add(rec)) return false;
+        }
+        return out.flush();
+    }
+
+    bool writeVehicles() {
+        auto file = createFile<VehicleRecord>("vehicles.dat");
+        if (!file) return false;
+        RecordAppender<VehicleRecord> out(*file);
+        fleet.resize(opts.vehicles);
+        for (size_t i = 0; i < opts.vehicles; ++i) {
+            VehicleSpec& v = fleet[i];
+            v.special = chance(opts.specialShare);
+            if (v.special) {
+                bool tall = chance(opts.tallShare);
+                v.height = tall ? centimetres(uniform(opts.minHeight, opts.maxHeight))
+                                : centimetres(uniform(1.2, 2.0));
+                // short-but-tall vehicles keep a regular length
+                v.length = (!tall || chance(0.5))
+                               ? centimetres(uniform(opts.minLength, opts.maxLength))
+                               : REGULAR_LENGTH;
+            } else {
+                v.height = 0;
+                v.length = 0;
+            }
+
+            VehicleRecord rec;
+            std::memset(&rec, 0, sizeof rec);
+            std::snprintf(rec.license, LICENSE_LENGTH, "GEN%07u", static_cast<unsigned>(i));
+            std::snprintf(rec.phone, PHONE_LENGTH, "%03zu-%03zu-%04zu",
+                          200 + i % 800, i / 10000 % 1000, i % 10000);
+            rec.heightCm  = v.height;
+            rec.lengthCm  = v.length;
+            rec.isSpecial = v.special;
+            if (!out.add(rec)) return false;
+        }
+        return out.flush();
+    }
+
+    static std::string terminalCode(size_t t) {
+        std::string code(3, 'A');
+        code[0] = static_cast<char>('A' + t / (26 * 26) % 26);
+        code[1] = static_cast<char>('A' + t / 26 % 26);
+        code[2] = static_cast<char>('A' + t % 26);
+        return code;
+    }
+
+    bool writeSailingsAndReservations() {
+        auto sfile = createFile<Sailing::Record>("sailings.dat");
+        if (!sfile) return false;
+        RecordAppender<Sailing::Record> sout(*sfile);
+
+        // one reservation shard per departure day, created on its first
+        // record; shards left by an earlier run are removed first
+        std::unique_ptr<RecordFile>                  rfile[ReservationIO::SHARD_COUNT];
+        std::unique_ptr<RecordAppender<Reservation>> rout[ReservationIO::SHARD_COUNT];
+        std::filesystem::remove(path("reservations.dat"));
+        for (int d = 0; d < ReservationIO::SHARD_COUNT; ++d)
+            std::filesystem::remove(path(ReservationIO::shardPath(d)));
+        if (opts.sailings > 0 && (opts.vessels == 0 || opts.vehicles == 0)) {
+            std::cerr << "Error: sailings need at least one vessel and one vehicle.\n";
+            return false;
+        }
+
+        size_t remaining = opts.reservations;
+        size_t written   = 0;
+        for (size_t s = 0; s < opts.sailings; ++s) {
+            // 1) Sailing ID: terminal + day + hour, unique per slot
+            size_t slot = s % SLOTS_PER_TERMINAL;
+            char sid[Sailing::ID_LEN];
+            std::snprintf(sid, sizeof sid, "%s-%02zu-%02zu",
+                          terminalCode(s / SLOTS_PER_TERMINAL).c_str(),
+                          slot / 24 + 1, slot % 24);
+
+            const int shard = ReservationIO::shardOf(sid);
+            const VesselRecord& vessel = vessels[pick(vessels.size())];
+            Sailing::Record rec(sid, vessel.vesselName,
+                                vessel.highLaneCm, vessel.lowLaneCm);
+
+            // 2) Book vehicles until the fill target or this sailing's quota
+            double fill   = std::clamp(opts.laneFill + uniform(-0.2, 0.2), 0.0, 1.0);
+            Centimetres target = static_cast<Centimetres>(
+                (vessel.highLaneCm + vessel.lowLaneCm) * fill);
+            size_t quota  = (remaining + (opts.sailings - s) - 1) / (opts.sailings - s);
+            size_t start  = pick(fleet.size());
+            Centimetres booked = 0;
+            int    people = 0;
+            int    misses = 0;
+
+            for (size_t k = 0; k < quota && k < fleet.size() && misses < 8; ++k) {
+                size_t vi = (start + k) % fleet.size();
+                const VehicleSpec& v = fleet[vi];
+                int         occupants = 1 + static_cast<int>(pick(opts.maxOccupants));
+                Centimetres length    = v.special ? v.length : REGULAR_LENGTH;
+                Centimetres need      = length + VEHICLE_BUF;
+                if (booked + need > target
+                 || people + occupants > vessel.maxPassengers) {
+                    ++misses;
+                    continue;
+                }
+
+                // same lane choice as createSpecialReservation
+                bool  usedHigh;
+                float fare;
+                if (v.special && v.height > LOW_LANE_HEIGHT) {
+                    if (rec.HRL_cm < need) { ++misses; continue; }
+                    usedHigh = true;
+                } else if (rec.LRL_cm >= need) {
+                    usedHigh = false;
+                } else if (rec.HRL_cm >= need) {
+                    usedHigh = true;
+                } else {
+                    ++misses;
+                    continue;
+                }
+                if (v.special) fare = length * (usedHigh ? 3 : 2) / 100.0f;
+                else           fare = REGULAR_FARE;
+
+                if (usedHigh) rec.HRL_cm -= need;
+                else          rec.LRL_cm -= need;
+                booked += need;
+                people += occupants;
+
+                char lic[LICENSE_LENGTH];
+                std::snprintf(lic, sizeof lic, "GEN%07u", static_cast<unsigned>(vi));
+                Reservation::Fields f;
+                f.sailingID       = sid;
+                f.license         = lic;
+                f.fare            = fare;
+                f.occupants       = static_cast<unsigned int>(occupants);
+                f.specialHeightCm = v.special ? v.height : 0;
+                f.specialLengthCm = v.special ? v.length : 0;
+                f.usedHighLane    = usedHigh;
+                f.checkedIn       = chance(opts.checkinShare);
+                Reservation res = Reservation::fromFields(f);
+
+                // 3) Check-ins update the sailing exactly like updateOccupants
+                if (f.checkedIn) {
+                    rec.LCU_cm       += need;
+                    rec.ppl_on_board += occupants;
+                    rec.veh_on_board += 1;
+                }
+                if (!rout[shard]) {
+                    rfile[shard] = createFile<Reservation>(ReservationIO::shardPath(shard));
+                    if (!rfile[shard]) return false;
+                    rout[shard] = std::make_unique<RecordAppender<Reservation>>(*rfile[shard]);
+                }
+                if (!rout[shard]->add(res)) return false;
+                ++written;
+                --remaining;
+            }
+
+            if (!sout.add(rec)) return false;
+        }
+
+        std::cout << "Generated " << opts.vessels << " vessels, "
+                  << opts.sailings << " sailings, "
+                  << opts.vehicles << " vehicles, "
+                  << written << " reservations in " << opts.outDir << "\n";
+        bool ok = sout.flush();
+        for (auto& out : rout)
+            if (out) ok = out->flush() && ok;
+        return ok;
+    }
+};
+
+namespace {
+    bool parseArgs(int argc, char** argv, Options& opts) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << "\n";
+                return false;
+            }
+            std::string v = argv[++i];
+            if      (arg == "--out")           opts.outDir       = v;
+            else if (arg == "--seed")          opts.seed         = std::stoul(v);
+            else if (arg == "--vessels")       opts.vessels      = std::stoul(v);
+            else if (arg == "--sailings")      opts.sailings     = std::stoul(v);
+            else if (arg == "--vehicles")      opts.vehicles     = std::stoul(v);
+            else if (arg == "--reservations")  opts.reservations = std::stoul(v);
+            else if (arg == "--special-share") opts.specialShare = std::stod(v);
+            else if (arg == "--tall-share")    opts.tallShare    = std::stod(v);
+            else if (arg == "--min-height")    opts.minHeight    = std::stof(v);
+            else if (arg == "--max-height")    opts.maxHeight    = std::stof(v);
+            else if (arg == "--min-length")    opts.minLength    = std::stof(v);
+            else if (arg == "--max-length")    opts.maxLength    = std::stof(v);
+            else if (arg == "--max-occupants") opts.maxOccupants = std::max(1, std::stoi(v));
+            else if (arg == "--lane-fill")     opts.laneFill     = std::stod(v);
+            else if (arg == "--checkin-share") opts.checkinShare = std::stod(v);
+            else {
+                std::cerr << "Unknown option " << arg << "\n";
+                return false;
+            }
+        }
+        if (opts.sailings > 26 * 26 * 26 * SLOTS_PER_TERMINAL) {
+            std::cerr << "Too many sailings for unique TER-DD-HH IDs.\n";
+            return false;
+        }
+        return true;
+    }
+}
+
+//------
+// Description:
+// Parses options and writes the four data files.
+int main(int argc, char** argv) {
+    Options opts;
+    if (!parseArgs(argc, argv, opts)) return 1;
+    DataGenerator gen(opts);
+    if (!gen.run()) {
+        std::cerr << "Error: failed writing data files to " << opts.outDir << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,306 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// migrate.cpp
+// Description:
+// Brings a data directory up to the current on-disk format. Each of
+// vessels.dat, sailings.dat, vehicles.dat and reservations.dat is
+// handled independently:
+// - a file that already starts with a valid RecordFile header for the
+//   current schema is left untouched;
+// - a bare record array (written before file headers existed) gets a
+//   header; if its lane lengths or vehicle dimensions are still float
+//   metres they are converted to whole centimetres (see units.h) on
+//   the way. Record sizes are the same in both encodings.
+// - a file with a header for some other schema is reported and left
+//   alone, since there is no conversion for it.
+// Once current, reservations.dat is split into the per-day shards
+// (reservations-DD.dat) that ReservationIO reads, and then removed.
+//
+// Each file is written to FILE.tmp, synced and renamed over the original
+// (RecordFile::replaceFile), so an interrupted run leaves every file
+// either fully old or fully new, and the tool can safely be run more
+// than once. While reservations.dat
+// exists it is the authoritative copy (the engine refuses to start
+// beside it), so shards left by an interrupted split are overwritten.
+//
+// Usage:
+//   make migrate
+//   build/setsail_migrate [DIR]
+//
+// Revision History:
+// Rev. 1 - 2025/08/25 - Team 12
+// - Initial implementation (float metres to centimetres)
+// Rev. 2 - 2025/08/27 - Team 12
+// - Adds RecordFile headers; renamed from migrate_cm.cpp
+// Rev. 3 - 2025/08/29 - Team 12
+// - Splits reservations.dat into per-day shards
+// Rev. 4 - 2025/08/31 - Team 12
+// - Files replaced through RecordFile::replaceFile (synced before rename)
+// Rev. 5 - 2025/09/02 - Team 12
+// - Reservations converted through Reservation::fromFields
+//*******************************
+
+#include "../sailing_io.h"
+#include "../vessel_io.h"
+#include "../vehicle_io.h"
+#include "../reservation_io.h"
+#include "../record_file.h"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    // Float-metre layouts, field for field
+    struct LegacyVessel {
+        char  vesselName[30];
+        int   maxPassengers;
+        float highLaneLength;
+        float lowLaneLength;
+    };
+
+    struct LegacySailing {
+        char  sailingID[Sailing::ID_LEN];
+        char  vessel_ID[Sailing::VLEN];
+        float HRL;
+        float LRL;
+        float LCU;
+        int   ppl_on_board;
+        int   veh_on_board;
+    };
+
+#pragma pack(push, 1)
+    struct LegacyVehicle {
+        char  license[LICENSE_LENGTH];
+        char  phone[PHONE_LENGTH];
+        float height;
+        float length;
+        bool  isSpecial;
+    };
+#pragma pack(pop)
+
+    struct LegacyReservation {
+        SailingKey   sailingID;
+        LicenseKey   license;
+        float        fare;
+        unsigned int occupants;
+        float        vehicleLength;
+        PhoneNumber  phone;
+        float        height;
+        float        length;
+        bool         usedHighLane;
+        bool         checkedIn;
+    };
+
+    static_assert(sizeof(LegacyVessel)      == sizeof(VesselRecord),    "vessel layout");
+    static_assert(sizeof(LegacySailing)     == sizeof(Sailing::Record), "sailing layout");
+    static_assert(sizeof(LegacyVehicle)     == sizeof(VehicleRecord),   "vehicle layout");
+    static_assert(sizeof(LegacyReservation) == sizeof(Reservation),     "reservation layout");
+
+    // No real length reaches a kilometre of centimetres, while any nonzero
+    // float of ordinary magnitude has a bit pattern far beyond it.
+    const int32_t MAX_PLAUSIBLE_CM = 100000000;
+
+    bool looksLikeFloat(float f) {
+        int32_t bits;
+        std::memcpy(&bits, &f, sizeof bits);
+        return bits > MAX_PLAUSIBLE_CM || bits < -MAX_PLAUSIBLE_CM;
+    }
+
+    enum class State { Missing, Current, Headerless, Foreign };
+}
+
+//------
+// Description:
+// Migrates each data file of one directory. Friend of Reservation so it
+// can fill the private dimension fields directly.
+class DataMigrator {
+public:
+    explicit DataMigrator(const std::string& dir) : dir(dir) {}
+
+    bool run() {
+        bool ok = true;
+        ok = migrate<VesselRecord,    LegacyVessel>("vessels.dat") && ok;
+        ok = migrate<Sailing::Record, LegacySailing>("sailings.dat") && ok;
+        ok = migrate<VehicleRecord,   LegacyVehicle>("vehicles.dat") && ok;
+        ok = migrate<Reservation,     LegacyReservation>("reservations.dat")
+          && splitReservations() && ok;
+        return ok;
+    }
+
+private:
+    std::string dir;
+
+    std::string path(const std::string& file) const {
+        return (std::filesystem::path(dir) / file).string();
+    }
+
+    // Classifies a file by its first bytes and, if it has a header,
+    // by whether that header matches the current format of R.
+    template <class R>
+    static State inspect(const std::string& file, std::string& why) {
+        std::error_code ec;
+        auto size = std::filesystem::file_size(file, ec);
+        if (ec || size == 0) return State::Missing;
+        std::ifstream in(file, std::ios::binary);
+        FileHeader header;
+        if (!RecordFile::readHeader(in, header)) return State::Headerless;
+        why = RecordFile::validate(header, RecordFile::formatOf<R>(),
+                                   static_cast<std::streamoff>(size));
+        return why.empty() ? State::Current : State::Foreign;
+    }
+
+    // Adds a header to a headerless file, converting metres if needed
+    template <class R, class Legacy>
+    bool migrate(const char* name) {
+        std::string file = path(name), why;
+        switch (inspect<R>(file, why)) {
+            case State::Missing:
+                std::cout << name << ": no data\n";
+                return true;
+            case State::Current:
+                std::cout << name << ": already current\n";
+                return true;
+            case State::Foreign:
+                std::cerr << name << ": " << why << "; not converted\n";
+                return false;
+            case State::Headerless:
+                break;
+        }
+
+        std::vector<Legacy> old;
+        {
+            std::ifstream in(file, std::ios::binary);
+            Legacy rec;
+            while (in.read(reinterpret_cast<char*>(&rec), sizeof rec)) old.push_back(rec);
+            if (!in.eof()) return false;
+        }
+        bool metres = false;
+        for (const Legacy& rec : old) metres = metres || isLegacy(rec);
+
+        std::vector<R> out(old.size());
+        for (size_t i = 0; i < old.size(); ++i) {
+            if (metres) convert(old[i], out[i]);
+            else        schema::decode(reinterpret_cast<const char*>(&old[i]), out[i]);
+        }
+        if (!RecordFile::replaceFile(file, RecordFile::freshHeader(RecordFile::formatOf<R>()), out))
+            return false;
+        std::cout << name << ": " << out.size() << " records, header added"
+                  << (metres ? ", metres converted to centimetres" : "") << "\n";
+        return true;
+    }
+
+    // Moves the records of a current reservations.dat into the day shards
+    bool splitReservations() {
+        std::string file = path("reservations.dat");
+        if (!std::filesystem::exists(file)) return true;
+
+        std::vector<Reservation> byShard[ReservationIO::SHARD_COUNT];
+        size_t total = 0;
+        {
+            std::ifstream in(file, std::ios::binary);
+            FileHeader header;
+            if (!RecordFile::readHeader(in, header)) return false;
+            Reservation rec;
+            while (schema::readRecord(in, rec)) {
+                if (!RecordFile::isLive(rec)) continue;
+                byShard[ReservationIO::shardOf(rec.fields().sailingID)].push_back(rec);
+                ++total;
+            }
+            if (!in.eof()) return false;
+        }
+
+        int shards = 0;
+        for (int d = 0; d < ReservationIO::SHARD_COUNT; ++d) {
+            if (byShard[d].empty()) continue;
+            if (!RecordFile::replaceFile(path(ReservationIO::shardPath(d)),
+                                         RecordFile::freshHeader(RecordFile::formatOf<Reservation>()),
+                                         byShard[d]))
+                return false;
+            ++shards;
+        }
+        std::error_code ec;
+        std::filesystem::remove(file, ec);
+        if (ec) return false;
+        std::cout << "reservations.dat: " << total << " records split into "
+                  << shards << " day shards\n";
+        return true;
+    }
+
+    static bool isLegacy(const LegacyVessel& v) {
+        return looksLikeFloat(v.highLaneLength) || looksLikeFloat(v.lowLaneLength);
+    }
+
+    static bool isLegacy(const LegacySailing& s) {
+        return looksLikeFloat(s.HRL) || looksLikeFloat(s.LRL) || looksLikeFloat(s.LCU);
+    }
+
+    static bool isLegacy(const LegacyVehicle& v) {
+        return looksLikeFloat(v.height) || looksLikeFloat(v.length);
+    }
+
+    static bool isLegacy(const LegacyReservation& r) {
+        return looksLikeFloat(r.vehicleLength) || looksLikeFloat(r.height)
+            || looksLikeFloat(r.length);
+    }
+
+    static void convert(const LegacyVessel& in, VesselRecord& out) {
+        std::memcpy(out.vesselName, in.vesselName, sizeof out.vesselName);
+        out.maxPassengers = in.maxPassengers;
+        out.highLaneCm    = toCentimetres(in.highLaneLength);
+        out.lowLaneCm     = toCentimetres(in.lowLaneLength);
+    }
+
+    static void convert(const LegacySailing& in, Sailing::Record& out) {
+        std::memcpy(out.sailingID, in.sailingID, Sailing::ID_LEN);
+        std::memcpy(out.vessel_ID, in.vessel_ID, Sailing::VLEN);
+        out.HRL_cm       = toCentimetres(in.HRL);
+        out.LRL_cm       = toCentimetres(in.LRL);
+        out.LCU_cm       = toCentimetres(in.LCU);
+        out.ppl_on_board = in.ppl_on_board;
+        out.veh_on_board = in.veh_on_board;
+    }
+
+    static void convert(const LegacyVehicle& in, VehicleRecord& out) {
+        std::memcpy(out.license, in.license, LICENSE_LENGTH);
+        std::memcpy(out.phone, in.phone, PHONE_LENGTH);
+        out.heightCm  = toCentimetres(in.height);
+        out.lengthCm  = toCentimetres(in.length);
+        out.isSpecial = in.isSpecial;
+    }
+
+    static void convert(const LegacyReservation& in, Reservation& out) {
+        Reservation::Fields f;
+        f.sailingID       = in.sailingID.view();
+        f.license         = in.license.view();
+        f.fare            = in.fare;
+        f.occupants       = in.occupants;
+        f.vehicleLengthCm = toCentimetres(in.vehicleLength);
+        f.phone           = in.phone.view();
+        f.specialHeightCm = toCentimetres(in.height);
+        f.specialLengthCm = toCentimetres(in.length);
+        f.usedHighLane    = in.usedHighLane;
+        f.checkedIn       = in.checkedIn;
+        out = Reservation::fromFields(f);
+    }
+};
+
+//------
+// Description:
+// Migrates the directory given on the command line (default: current).
+int main(int argc, char** argv) {
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [DIR]\n";
+        return 1;
+    }
+    DataMigrator migrator(argc == 2 ? argv[1] : ".");
+    if (!migrator.run()) {
+        std::cerr << "Error: migration incomplete; unconverted files were left as they were\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,215 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// replay.cpp
+// Description:
+// Replays a trace recorded with SETSAIL_TRACE against a fresh data
+// directory and reports throughput and per-operation tail latency, so a
+// recorded production day can be rerun as a repeatable load test.
+//
+// By default events run back to back as fast as possible; --paced keeps
+// the recorded gaps between events (optionally scaled by --speed).
+//
+// Usage:
+//   make replay
+//   build/setsail_replay TRACE [--data DIR] [--paced] [--speed X] [--stats]
+//
+// Revision History:
+// Rev. 1 - 2025/08/20 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Newer trace versions and ops reported apart from corrupt traces
+// Rev. 3 - 2025/09/02 - Team 12
+// - Stops if a data file cannot be opened
+//*******************************
+
+#include "../trace.h"
+#include "../stats.h"
+#include "../vessel.h"
+#include "../sailing.h"
+#include "../reservation.h"
+#include "../reservation_io.h"
+#include "../vehicle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string tracePath;
+        std::string dataDir = "replay_data";
+        bool        paced   = false;
+        double      speed   = 1.0;
+        bool        stats   = false;
+    };
+
+    struct OpTimes {
+        std::vector<double> ns;
+        size_t failed = 0;
+    };
+
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return c; }
+    };
+
+    double percentile(const std::vector<double>& sorted, double p) {
+        if (sorted.empty()) return 0.0;
+        size_t at = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(at, sorted.size() - 1)];
+    }
+
+    void printRow(const std::string& name, std::vector<double>& ns, size_t failed) {
+        std::sort(ns.begin(), ns.end());
+        double sum = 0.0;
+        for (double v : ns) sum += v;
+        std::cout << std::left  << std::setw(26) << name
+                  << std::right << std::setw(9)  << ns.size()
+                  << std::setw(8)  << failed
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(12) << (ns.empty() ? 0.0 : sum / ns.size() / 1000.0)
+                  << std::setw(12) << percentile(ns, 0.50) / 1000.0
+                  << std::setw(12) << percentile(ns, 0.99) / 1000.0
+                  << std::setw(12) << percentile(ns, 0.999) / 1000.0
+                  << std::setw(12) << (ns.empty() ? 0.0 : ns.back() / 1000.0)
+                  << "\n";
+    }
+
+    bool parseArgs(int argc, char** argv, Options& opts) {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--paced") {
+                opts.paced = true;
+            } else if (arg == "--stats") {
+                opts.stats = true;
+            } else if (arg == "--data" && i + 1 < argc) {
+                opts.dataDir = argv[++i];
+            } else if (arg == "--speed" && i + 1 < argc) {
+                opts.speed = std::max(0.001, std::stod(argv[++i]));
+            } else if (opts.tracePath.empty() && arg[0] != '-') {
+                opts.tracePath = arg;
+            } else {
+                std::cerr << "Unknown option " << arg << "\n";
+                return false;
+            }
+        }
+        if (opts.tracePath.empty()) {
+            std::cerr << "Usage: setsail_replay TRACE [--data DIR] [--paced] [--speed X] [--stats]\n";
+            return false;
+        }
+        return true;
+    }
+}
+
+//------
+// Description:
+// Replays the trace and prints the throughput and latency report.
+int main(int argc, char** argv) {
+    Options opts;
+    if (!parseArgs(argc, argv, opts)) return 1;
+
+    std::ifstream in(opts.tracePath, std::ios::binary);
+    uint16_t version = 0;
+    Trace::Read read = in ? Trace::readHeader(in, version) : Trace::Read::CORRUPT;
+    if (read == Trace::Read::UNSUPPORTED) {
+        std::cerr << "Error: " << opts.tracePath << " is trace version " << version
+                  << "; this build reads up to version " << Trace::VERSION << "\n";
+        return 1;
+    }
+    if (read != Trace::Read::OK) {
+        std::cerr << "Error: " << opts.tracePath << " is not a SetSail trace\n";
+        return 1;
+    }
+
+    // 1) Fresh data directory
+    std::filesystem::create_directories(opts.dataDir);
+    std::filesystem::current_path(opts.dataDir);
+    for (const char* f : {"sailings.dat", "vessels.dat", "vehicles.dat", "reservations.dat"})
+        std::filesystem::remove(f);
+    for (int d = 0; d < ReservationIO::SHARD_COUNT; ++d)
+        std::filesystem::remove(ReservationIO::shardPath(d));
+    if (!Vessel::init() || !Sailing::init() || !Reservation::init() || !Vehicle::init()) {
+        std::cerr << "Error: cannot create the data files in " << opts.dataDir << "\n";
+        return 1;
+    }
+    Stats::setEnabled(opts.stats);
+
+    // 2) Replay every event, optionally at the recorded pace
+    std::map<std::string, OpTimes> byOp;
+    std::vector<double> all;
+    size_t failed = 0;
+    uint64_t lastNs = 0;
+    Trace::Event ev;
+    NullBuffer nullBuffer;
+
+    auto start = Clock::now();
+    while ((read = Trace::readEvent(in, lastNs, ev)) == Trace::Read::OK) {
+        if (opts.paced) {
+            auto due = start + std::chrono::nanoseconds(
+                           static_cast<uint64_t>(ev.timestampNs / opts.speed));
+            std::this_thread::sleep_until(due);
+        }
+
+        std::streambuf* oldOut = std::cout.rdbuf(&nullBuffer);
+        std::streambuf* oldErr = std::cerr.rdbuf(&nullBuffer);
+        auto t0 = Clock::now();
+        bool ok = Trace::execute(ev);
+        auto t1 = Clock::now();
+        std::cout.rdbuf(oldOut);
+        std::cerr.rdbuf(oldErr);
+
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        OpTimes& t = byOp[Trace::opName(ev.op)];
+        t.ns.push_back(ns);
+        all.push_back(ns);
+        if (!ok) {
+            ++t.failed;
+            ++failed;
+        }
+    }
+    double wall = std::chrono::duration<double>(Clock::now() - start).count();
+    if (read == Trace::Read::UNSUPPORTED)
+        std::cerr << "Warning: stopped after " << all.size() << " events at op "
+                  << unsigned(ev.op) << ", which this build does not know\n";
+    else if (read == Trace::Read::CORRUPT)
+        std::cerr << "Warning: trace is truncated or corrupt after "
+                  << all.size() << " events\n";
+
+    // 3) Report
+    std::cout << "Replayed " << all.size() << " events in "
+              << std::fixed << std::setprecision(3) << wall << " s ("
+              << std::setprecision(1) << (wall > 0 ? all.size() / wall : 0.0)
+              << " ops/s), " << failed << " returned false\n\n"
+              << std::left  << std::setw(26) << "Operation"
+              << std::right << std::setw(9)  << "Count"
+              << std::setw(8)  << "False"
+              << std::setw(12) << "Mean(us)"
+              << std::setw(12) << "P50(us)"
+              << std::setw(12) << "P99(us)"
+              << std::setw(12) << "P99.9(us)"
+              << std::setw(12) << "Max(us)"
+              << "\n" << std::string(103, '=') << "\n";
+    for (auto& kv : byOp) printRow(kv.first, kv.second.ns, kv.second.failed);
+    std::cout << std::string(103, '-') << "\n";
+    printRow("all", all, failed);
+
+    if (opts.stats) {
+        std::cout << "\n";
+        Stats::printReport(std::cout);
+    }
+
+    Sailing::shutdown();
+    Reservation::shutdown();
+    Vehicle::shutdown();
+    Vessel::shutdown();
+    return read == Trace::Read::END ? 0 : 1;
+}
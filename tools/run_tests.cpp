@@ -0,0 +1,73 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// run_tests.cpp
+// Description:
+// Runs the unit test drivers (the root-level *Test.cpp files), each in a
+// fresh subdirectory of a scratch directory so that no test sees another
+// test's data files, and exits non-zero if any of them fails.
+//
+// Usage:
+//   make test
+//   build/setsail_test [DIR]      (default scratch directory: test_data)
+//
+// Revision History:
+// Rev. 1 - 2025/09/02 - Team 12
+// - Initial implementation
+//*******************************
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+int vehicleIOTest();
+int lzTest();
+int recordFileTest();
+int archiveTest();
+int reassignTest();
+
+namespace {
+    struct TestCase {
+        const char* name;
+        int (*run)();
+    };
+
+    const TestCase TESTS[] = {
+        { "vehicleIO",  vehicleIOTest  },
+        { "lz",         lzTest         },
+        { "recordFile", recordFileTest },
+        { "archive",    archiveTest    },
+        { "reassign",   reassignTest   },
+    };
+}
+
+//------
+// Description:
+// Runs every test driver and reports how many failed.
+int main(int argc, char** argv) {
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [DIR]\n";
+        return 1;
+    }
+    namespace fs = std::filesystem;
+    const fs::path scratch = fs::absolute(argc == 2 ? argv[1] : "test_data");
+
+    int failed = 0;
+    for (const TestCase& test : TESTS) {
+        const fs::path dir = scratch / test.name;
+        std::error_code ec;
+        fs::remove_all(dir, ec);
+        fs::create_directories(dir, ec);
+        if (ec) {
+            std::cerr << "Error: cannot create " << dir << ": " << ec.message() << "\n";
+            return 1;
+        }
+        fs::current_path(dir);
+        if (test.run() != 0) {
+            std::cerr << test.name << " test: FAIL\n";
+            ++failed;
+        }
+    }
+    std::cout << (sizeof TESTS / sizeof TESTS[0]) - failed << " passed, "
+              << failed << " failed\n";
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,379 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// trace.cpp
+// Description:
+// Implementation of the Trace class: binary encoding of domain calls,
+// decoding, and dispatch back into the domain classes for replay.
+//
+// Revision History:
+// Rev. 1 - 2025/08/20 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Rebookings
+// Rev. 3 - 2025/09/02 - Team 12
+// - Sailing cancellations with reassignment
+// Rev. 4 - 2025/09/02 - Team 12
+// - Vessel substitutions
+// Rev. 5 - 2025/09/02 - Team 12
+// - Format version 2; unknown versions and ops reported apart from damage
+//*******************************
+
+#include "trace.h"
+#include "vessel.h"
+#include "sailing.h"
+#include "reservation.h"
+#include "reassign.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    const char MAGIC[4] = {'S', 'S', 'T', 'R'};
+
+    using Clock = std::chrono::steady_clock;
+
+    std::ofstream traceFile;
+    bool          recording = false;
+    Clock::time_point startTime;
+    uint64_t      lastEventNs = 0;
+
+    void putByte(uint8_t b) {
+        traceFile.put(static_cast<char>(b));
+    }
+
+    void putVarint(uint64_t v) {
+        while (v >= 0x80) {
+            putByte(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        putByte(static_cast<uint8_t>(v));
+    }
+
+    void putString(std::string_view s) {
+        putVarint(s.size());
+        traceFile.write(s.data(), static_cast<std::streamsize>(s.size()));
+    }
+
+    void putFloat(float f) {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof bits);
+        for (int i = 0; i < 4; ++i) putByte(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+
+    // Writes the op byte and the time since the previous event.
+    void beginEvent(Trace::Op op) {
+        uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           Clock::now() - startTime).count());
+        putByte(op);
+        putVarint(now - lastEventNs);
+        lastEventNs = now;
+    }
+
+    bool getByte(std::istream& in, uint8_t& b) {
+        char c;
+        if (!in.get(c)) return false;
+        b = static_cast<uint8_t>(c);
+        return true;
+    }
+
+    bool getVarint(std::istream& in, uint64_t& v) {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b;
+            if (!getByte(in, b)) return false;
+            v |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    bool getString(std::istream& in, std::string& s) {
+        uint64_t len;
+        if (!getVarint(in, len) || len > 4096) return false;
+        s.resize(static_cast<size_t>(len));
+        return len == 0 || static_cast<bool>(in.read(&s[0], static_cast<std::streamsize>(len)));
+    }
+
+    bool getFloat(std::istream& in, float& f) {
+        uint32_t bits = 0;
+        for (int i = 0; i < 4; ++i) {
+            uint8_t b;
+            if (!getByte(in, b)) return false;
+            bits |= static_cast<uint32_t>(b) << (8 * i);
+        }
+        std::memcpy(&f, &bits, sizeof f);
+        return true;
+    }
+
+    bool getCount(std::istream& in, uint32_t& count) {
+        uint64_t v;
+        if (!getVarint(in, v)) return false;
+        count = static_cast<uint32_t>(v);
+        return true;
+    }
+}
+
+bool Trace::start(const std::string& path) {
+    stop();
+    traceFile.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!traceFile) {
+        std::cerr << "Error: Unable to open trace file " << path << "\n";
+        return false;
+    }
+    traceFile.write(MAGIC, sizeof MAGIC);
+    putByte(static_cast<uint8_t>(VERSION & 0xff));
+    putByte(static_cast<uint8_t>(VERSION >> 8));
+    startTime   = Clock::now();
+    lastEventNs = 0;
+    recording   = true;
+    return true;
+}
+
+void Trace::initFromEnvironment() {
+    const char* path = std::getenv("SETSAIL_TRACE");
+    if (path && *path) start(path);
+}
+
+void Trace::stop() {
+    if (!recording) return;
+    traceFile.flush();
+    traceFile.close();
+    recording = false;
+}
+
+bool Trace::isRecording() {
+    return recording;
+}
+
+void Trace::recordCreateVessel(std::string_view name, int capacity,
+                               float highLaneLength, float lowLaneLength)
+{
+    if (!recording) return;
+    beginEvent(CREATE_VESSEL);
+    putString(name);
+    putVarint(static_cast<uint32_t>(capacity));
+    putFloat(highLaneLength);
+    putFloat(lowLaneLength);
+}
+
+void Trace::recordDeleteVessel(std::string_view name) {
+    if (!recording) return;
+    beginEvent(DELETE_VESSEL);
+    putString(name);
+}
+
+void Trace::recordCreateSailing(std::string_view vesselName,
+                                std::string_view departTerm,
+                                std::string_view departDay,
+                                std::string_view departTime)
+{
+    if (!recording) return;
+    beginEvent(CREATE_SAILING);
+    putString(vesselName);
+    putString(departTerm);
+    putString(departDay);
+    putString(departTime);
+}
+
+void Trace::recordDeleteSailing(std::string_view sailingID) {
+    if (!recording) return;
+    beginEvent(DELETE_SAILING);
+    putString(sailingID);
+}
+
+void Trace::recordCreateReservation(std::string_view sailingID,
+                                    std::string_view license,
+                                    unsigned int occupants,
+                                    std::string_view phone)
+{
+    if (!recording) return;
+    beginEvent(CREATE_RESERVATION);
+    putString(sailingID);
+    putString(license);
+    putString(phone);
+    putVarint(occupants);
+}
+
+void Trace::recordCreateSpecialReservation(std::string_view sailingID,
+                                           std::string_view license,
+                                           unsigned int occupants,
+                                           std::string_view phone,
+                                           float height,
+                                           float length)
+{
+    if (!recording) return;
+    beginEvent(CREATE_SPECIAL_RESERVATION);
+    putString(sailingID);
+    putString(license);
+    putString(phone);
+    putVarint(occupants);
+    putFloat(height);
+    putFloat(length);
+}
+
+void Trace::recordCancelReservation(std::string_view sailingID,
+                                    std::string_view license)
+{
+    if (!recording) return;
+    beginEvent(CANCEL_RESERVATION);
+    putString(sailingID);
+    putString(license);
+}
+
+void Trace::recordLogArrivals(std::string_view sailingID,
+                              std::string_view license)
+{
+    if (!recording) return;
+    beginEvent(LOG_ARRIVALS);
+    putString(sailingID);
+    putString(license);
+}
+
+void Trace::recordRebookReservation(std::string_view license,
+                                    std::string_view fromSailingID,
+                                    std::string_view toSailingID)
+{
+    if (!recording) return;
+    beginEvent(REBOOK_RESERVATION);
+    putString(license);
+    putString(fromSailingID);
+    putString(toSailingID);
+}
+
+void Trace::recordCancelSailing(std::string_view sailingID,
+                                const std::vector<std::string>& alternatives)
+{
+    if (!recording) return;
+    std::string joined;
+    for (const std::string& id : alternatives) {
+        if (!joined.empty()) joined += ',';
+        joined += id;
+    }
+    beginEvent(CANCEL_SAILING);
+    putString(sailingID);
+    putString(joined);
+}
+
+void Trace::recordSubstituteVessel(std::string_view sailingID,
+                                   std::string_view vesselName)
+{
+    if (!recording) return;
+    beginEvent(SUBSTITUTE_VESSEL);
+    putString(sailingID);
+    putString(vesselName);
+}
+
+Trace::Read Trace::readHeader(std::istream& in, uint16_t& version) {
+    char magic[sizeof MAGIC];
+    uint8_t lo, hi;
+    if (!in.read(magic, sizeof magic) || std::memcmp(magic, MAGIC, sizeof MAGIC) != 0)
+        return Read::CORRUPT;
+    if (!getByte(in, lo) || !getByte(in, hi)) return Read::CORRUPT;
+    version = static_cast<uint16_t>(lo | (hi << 8));
+    if (version == 0) return Read::CORRUPT;
+    return version > VERSION ? Read::UNSUPPORTED : Read::OK;
+}
+
+Trace::Read Trace::readEvent(std::istream& in, uint64_t& lastNs, Event& out) {
+    uint8_t  op;
+    uint64_t delta;
+    if (!getByte(in, op)) return Read::END;
+    if (!getVarint(in, delta)) return Read::CORRUPT;
+    out = Event();
+    out.op          = static_cast<Op>(op);
+    out.timestampNs = lastNs + delta;
+    lastNs          = out.timestampNs;
+    if (op == 0) return Read::CORRUPT;
+    if (op > LAST_OP) return Read::UNSUPPORTED;
+    return readFields(in, out) ? Read::OK : Read::CORRUPT;
+}
+
+bool Trace::readFields(std::istream& in, Event& out) {
+    switch (out.op) {
+        case CREATE_VESSEL:
+            return getString(in, out.text[0]) && getCount(in, out.count)
+                && getFloat(in, out.len1) && getFloat(in, out.len2);
+        case DELETE_VESSEL:
+        case DELETE_SAILING:
+            return getString(in, out.text[0]);
+        case CREATE_SAILING:
+            return getString(in, out.text[0]) && getString(in, out.text[1])
+                && getString(in, out.text[2]) && getString(in, out.text[3]);
+        case CREATE_RESERVATION:
+            return getString(in, out.text[0]) && getString(in, out.text[1])
+                && getString(in, out.text[2]) && getCount(in, out.count);
+        case CREATE_SPECIAL_RESERVATION:
+            return getString(in, out.text[0]) && getString(in, out.text[1])
+                && getString(in, out.text[2]) && getCount(in, out.count)
+                && getFloat(in, out.len1) && getFloat(in, out.len2);
+        case CANCEL_RESERVATION:
+        case LOG_ARRIVALS:
+            return getString(in, out.text[0]) && getString(in, out.text[1]);
+        case REBOOK_RESERVATION:
+            return getString(in, out.text[0]) && getString(in, out.text[1])
+                && getString(in, out.text[2]);
+        case CANCEL_SAILING:
+        case SUBSTITUTE_VESSEL:
+            return getString(in, out.text[0]) && getString(in, out.text[1]);
+    }
+    return false;
+}
+
+bool Trace::execute(const Event& ev) {
+    switch (ev.op) {
+        case CREATE_VESSEL:
+            return Vessel::createVessel(ev.text[0], static_cast<int>(ev.count), ev.len1, ev.len2);
+        case DELETE_VESSEL:
+            return Vessel::deleteVessel(ev.text[0]);
+        case CREATE_SAILING:
+            return Sailing::createSailing(ev.text[0], ev.text[1], ev.text[2], ev.text[3]);
+        case DELETE_SAILING:
+            return Sailing::deleteSailing(ev.text[0]);
+        case CREATE_RESERVATION:
+            return Reservation::createReservation(ev.text[0], ev.text[1], ev.count, ev.text[2]);
+        case CREATE_SPECIAL_RESERVATION:
+            return Reservation::createSpecialReservation(ev.text[0], ev.text[1], ev.count,
+                                                         ev.text[2], ev.len1, ev.len2);
+        case CANCEL_RESERVATION:
+            return Reservation::cancelReservation(ev.text[0], ev.text[1]);
+        case LOG_ARRIVALS:
+            return Reservation::logArrivals(ev.text[0], ev.text[1]);
+        case REBOOK_RESERVATION:
+            return Reservation::rebookReservation(ev.text[0], ev.text[1], ev.text[2]);
+        case CANCEL_SAILING: {
+            std::vector<std::string> alternatives;
+            std::string id;
+            std::istringstream list(ev.text[1]);
+            while (std::getline(list, id, ',')) if (!id.empty()) alternatives.push_back(id);
+            Reassignment::Outcome outcome;
+            return Reassignment::cancelSailing(ev.text[0], alternatives, outcome);
+        }
+        case SUBSTITUTE_VESSEL: {
+            Reassignment::Substitution result;
+            return Reassignment::substituteVessel(ev.text[0], ev.text[1], result);
+        }
+    }
+    return false;
+}
+
+const char* Trace::opName(Op op) {
+    switch (op) {
+        case CREATE_VESSEL:              return "createVessel";
+        case DELETE_VESSEL:              return "deleteVessel";
+        case CREATE_SAILING:             return "createSailing";
+        case DELETE_SAILING:             return "deleteSailing";
+        case CREATE_RESERVATION:         return "createReservation";
+        case CREATE_SPECIAL_RESERVATION: return "createSpecialReservation";
+        case CANCEL_RESERVATION:         return "cancelReservation";
+        case LOG_ARRIVALS:               return "logArrivals";
+        case REBOOK_RESERVATION:         return "rebookReservation";
+        case CANCEL_SAILING:             return "cancelSailing";
+        case SUBSTITUTE_VESSEL:          return "substituteVessel";
+    }
+    return "unknown";
+}
@@ -0,0 +1,207 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// trace.h
+// Description:
+// Optional capture of every domain call (vessel, sailing and reservation
+// creates/deletes, cancellations, rebookings, check-ins, sailing
+// cancellations and vessel substitutions) with its arguments and a
+// timestamp into a compact binary trace. A trace can be read back and
+// re-executed against a fresh data directory by the replay tool
+// (tools/replay.cpp).
+//
+// Recording starts when SETSAIL_TRACE=<file> is set in the environment at
+// startup, or when Trace::start() is called.
+//
+// File format (little-endian):
+//   header : "SSTR" magic, u16 version (Trace::VERSION; bumped whenever
+//            an op is added or its fields change)
+//   event  : u8 op, varint ns since previous event, then the op's fields;
+//            strings are varint length + bytes, counts are varints and
+//            lengths are 4-byte IEEE floats
+//
+// Revision History:
+// Rev. 1 - 2025/08/20 - Team 12
+// - Initial implementation
+// Rev. 2 - 2025/09/02 - Team 12
+// - Rebookings
+// Rev. 3 - 2025/09/02 - Team 12
+// - Sailing cancellations with reassignment
+// Rev. 4 - 2025/09/02 - Team 12
+// - Vessel substitutions
+// Rev. 5 - 2025/09/02 - Team 12
+// - Format version 2; reads tell a newer trace from a corrupt one
+//*******************************
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Trace {
+public:
+    // Recorded domain calls
+    enum Op : uint8_t {
+        CREATE_VESSEL = 1,
+        DELETE_VESSEL,
+        CREATE_SAILING,
+        DELETE_SAILING,
+        CREATE_RESERVATION,
+        CREATE_SPECIAL_RESERVATION,
+        CANCEL_RESERVATION,
+        LOG_ARRIVALS,
+        REBOOK_RESERVATION,
+        CANCEL_SAILING,
+        SUBSTITUTE_VESSEL,
+        LAST_OP = SUBSTITUTE_VESSEL
+    };
+
+    // Format written by start(); traces of this or an older version can
+    // be read. 1: ops up to LOG_ARRIVALS. 2: REBOOK_RESERVATION,
+    // CANCEL_SAILING and SUBSTITUTE_VESSEL.
+    static constexpr uint16_t VERSION = 2;
+
+    // Result of reading a trace header or event
+    enum class Read {
+        OK,
+        END,          // no more events
+        CORRUPT,      // not a trace, or truncated or damaged
+        UNSUPPORTED   // a newer version or op than this build knows
+    };
+
+    // One decoded call. Field use per op:
+    //   CREATE_VESSEL              text = {name}, count = capacity,
+    //                              len1 = high lane, len2 = low lane
+    //   DELETE_VESSEL              text = {name}
+    //   CREATE_SAILING             text = {vessel, terminal, day, time}
+    //   DELETE_SAILING             text = {sailingID}
+    //   CREATE_RESERVATION         text = {sailingID, license, phone}, count = occupants
+    //   CREATE_SPECIAL_RESERVATION text = {sailingID, license, phone}, count = occupants,
+    //                              len1 = height, len2 = length
+    //   CANCEL_RESERVATION         text = {sailingID, license}
+    //   LOG_ARRIVALS               text = {sailingID, license}
+    //   REBOOK_RESERVATION         text = {license, from sailingID, to sailingID}
+    //   CANCEL_SAILING             text = {sailingID, alternatives joined by ','}
+    //   SUBSTITUTE_VESSEL          text = {sailingID, vessel}
+    struct Event {
+        Op          op          = CREATE_VESSEL;
+        uint64_t    timestampNs = 0;   // since the start of the trace
+        std::string text[4];
+        uint32_t    count       = 0;
+        float       len1        = 0.0f;
+        float       len2        = 0.0f;
+    };
+
+    //------
+    // Description:
+    // Starts recording to `path`, replacing any existing file. Returns true
+    // if the trace file could be opened.
+    // Precondition:
+    // None
+    static bool start(
+        const std::string& path  // [in] Trace file to write
+    );
+
+    //------
+    // Description:
+    // Starts recording if SETSAIL_TRACE names a trace file.
+    // Precondition:
+    // None
+    static void initFromEnvironment();
+
+    //------
+    // Description:
+    // Flushes and closes the trace file.
+    // Precondition:
+    // None
+    static void stop();
+
+    //------
+    // Description:
+    // Returns true while a trace is being recorded.
+    // Precondition:
+    // None
+    static bool isRecording();
+
+    // Capture one domain call; no-ops unless recording
+    static void recordCreateVessel(std::string_view name, int capacity,
+                                   float highLaneLength, float lowLaneLength);
+    static void recordDeleteVessel(std::string_view name);
+    static void recordCreateSailing(std::string_view vesselName,
+                                    std::string_view departTerm,
+                                    std::string_view departDay,
+                                    std::string_view departTime);
+    static void recordDeleteSailing(std::string_view sailingID);
+    static void recordCreateReservation(std::string_view sailingID,
+                                        std::string_view license,
+                                        unsigned int occupants,
+                                        std::string_view phone);
+    static void recordCreateSpecialReservation(std::string_view sailingID,
+                                               std::string_view license,
+                                               unsigned int occupants,
+                                               std::string_view phone,
+                                               float height,
+                                               float length);
+    static void recordCancelReservation(std::string_view sailingID,
+                                        std::string_view license);
+    static void recordLogArrivals(std::string_view sailingID,
+                                  std::string_view license);
+    static void recordRebookReservation(std::string_view license,
+                                        std::string_view fromSailingID,
+                                        std::string_view toSailingID);
+    static void recordCancelSailing(std::string_view sailingID,
+                                    const std::vector<std::string>& alternatives);
+    static void recordSubstituteVessel(std::string_view sailingID,
+                                       std::string_view vesselName);
+
+    //------
+    // Description:
+    // Reads and checks the trace header. Returns CORRUPT if `in` is not a
+    // trace and UNSUPPORTED if it was written in a newer format.
+    // Precondition:
+    // `in` is positioned at the start of a trace file
+    static Read readHeader(
+        std::istream& in,   // [in/out] Trace stream
+        uint16_t& version   // [out] Format version of the trace
+    );
+
+    //------
+    // Description:
+    // Decodes the next event. `lastNs` carries the previous event's
+    // timestamp between calls. Returns END at the end of the trace,
+    // CORRUPT on a truncated event and UNSUPPORTED on an op this build
+    // does not know.
+    // Precondition:
+    // readHeader has returned OK on `in`
+    static Read readEvent(
+        std::istream& in,   // [in/out] Trace stream
+        uint64_t& lastNs,   // [in/out] Timestamp of the previous event
+        Event& out          // [out] Decoded event
+    );
+
+    //------
+    // Description:
+    // Re-executes one event through the domain classes. Returns the result
+    // of the domain call.
+    // Precondition:
+    // All subsystems must be initialized
+    static bool execute(
+        const Event& ev  // [in] Event to replay
+    );
+
+    //------
+    // Description:
+    // Returns the printable name of an operation.
+    // Precondition:
+    // None
+    static const char* opName(Op op);
+
+private:
+    // Decodes the fields of `out.op` into `out`; false if they are cut short
+    static bool readFields(std::istream& in, Event& out);
+};
+
+#endif // TRACE_H
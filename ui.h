@@ -10,15 +10,21 @@
 // - Converted to class format with initialization/shutdown
 // Rev. 2 - 2025/07/23 - Team 12
 // - Changed to static
+// Rev. 3 - 2025/09/02 - Team 12
+// - startup fails if a data file cannot be opened
 //*******************************
 #ifndef USERINTERFACE_H
 #define USERINTERFACE_H
 
+#include <string>
+
 class UserInterface {
 public:
     //------
     // Description:
-    // Initializes the UserInterface class. Returns true if successful.
+    // Initializes the UserInterface class. Returns true if successful;
+    // false, with every subsystem closed again, if a data file cannot be
+    // opened.
     // Precondition:
     // None
     static bool startup();
@@ -65,6 +71,17 @@ public:
     // None
     static void chooseReservation();    
 
+    //------
+    // Description:
+    // Lists other sailings on the same or the next day that still have
+    // room for the vehicle, after a reservation could not be made.
+    // Precondition:
+    // Sailing subsystem must be initialized
+    static void suggestSailings(const std::string& sailingID,
+                                unsigned int occupants,
+                                float height,
+                                float length);
+
     //------
     // Description:
     // Displays operations for handeling check-in
@@ -79,6 +96,27 @@ public:
     // None
     static void printSailing();
 
+    //------
+    // Description:
+    // Displays the fleet utilisation rollups (vessel, terminal, day, hour)
+    // Precondition:
+    // None
+    static void printUtilisation();
+
+    //------
+    // Description:
+    // Prompts for a range of departure days and displays revenue totals
+    // Precondition:
+    // None
+    static void printRevenue();
+
+    //------
+    // Description:
+    // Displays operations for viewing, toggling and resetting statistics
+    // Precondition:
+    // None
+    static void chooseStats();
+
     //------
     // Description:
     // Displays main menu
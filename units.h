@@ -0,0 +1,41 @@
+//@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@
+//*******************************
+// units.h
+// Description:
+// Lane lengths and vehicle dimensions are stored and computed as whole
+// centimetres so that repeated book/cancel cycles add and subtract
+// exactly. Metres (float) appear only where users type or read values;
+// convert with toCentimetres()/toMetres() at that boundary.
+//
+// Revision History:
+// Rev. 1 - 2025/08/25 - Team 12
+// - Initial implementation
+//*******************************
+
+#ifndef UNITS_H
+#define UNITS_H
+
+#include <cmath>
+#include <cstdint>
+
+using Centimetres = int32_t;
+
+//------
+// Description:
+// Rounds a length in metres to the nearest centimetre.
+// Precondition:
+// None
+inline Centimetres toCentimetres(float metres) {
+    return static_cast<Centimetres>(std::lround(static_cast<double>(metres) * 100.0));
+}
+
+//------
+// Description:
+// Converts centimetres back to metres for display.
+// Precondition:
+// None
+inline float toMetres(Centimetres cm) {
+    return static_cast<float>(cm) / 100.0f;
+}
+
+#endif // UNITS_H
@@ -67,8 +67,8 @@ void Vehicle::shutdown() {
 // Precondition:
 // Valid vehicle data and unique license
 bool Vehicle::createVehicleForReservation(
-    const std::string& licensePlate,
-    const std::string& phoneNumber
+    std::string_view licensePlate,
+    std::string_view phoneNumber
 ) {
     Vehicle veh;
     veh.currentLicensePlate = licensePlate;
@@ -86,8 +86,8 @@ bool Vehicle::createVehicleForReservation(
 // Precondition:
 // Valid vehicle data and unique license
 bool Vehicle::createSpecialVehicleForReservation(
-    const std::string& licensePlate,
-    const std::string& phoneNumber,
+    std::string_view licensePlate,
+    std::string_view phoneNumber,
     float height,
     float length
 ) {
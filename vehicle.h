@@ -13,6 +13,7 @@
 
 #pragma once
 #include <string>
+#include <string_view>
 
 class Vehicle {
 public:
@@ -47,8 +48,8 @@ public:
     // Precondition:
     // Valid vehicle data and unique license
     static bool createVehicleForReservation(
-        const std::string& licensePlate,  // [in] Vehicle license plate
-        const std::string& phoneNumber    // [in] Owner's phone number
+        std::string_view licensePlate,  // [in] Vehicle license plate
+        std::string_view phoneNumber    // [in] Owner's phone number
     );
 
     //------
@@ -57,10 +58,10 @@ public:
     // Precondition:
     // Valid vehicle data and unique license
     static bool createSpecialVehicleForReservation(
-        const std::string& licensePlate,  // [in] Vehicle license plate
-        const std::string& phoneNumber,   // [in] Owner's phone number
-        float height,                     // [in] Vehicle height in meters
-        float length                      // [in] Vehicle length in meters
+        std::string_view licensePlate,  // [in] Vehicle license plate
+        std::string_view phoneNumber,   // [in] Owner's phone number
+        float height,                   // [in] Vehicle height in meters
+        float length                    // [in] Vehicle length in meters
     );
 
 private:
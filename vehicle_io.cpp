@@ -7,137 +7,326 @@
 // Implementation Notes:
 // - Uses fixed-length binary records for storage
 // - File operations are unsorted (as per assignment requirements)
-// - Implements simple linear search for record retrieval
+// - Lookups scan an in-memory column of 32-byte license keys with a
+//   vector compare (AVX2, SSE2 or NEON; memcmp otherwise), then read the
+//   single matching record; a Bloom filter over the keys answers most
+//   lookups of unknown licenses before the column is scanned
+// - Vehicles are never deleted: reservations refer to them by license.
+//   New vehicles would fill freed slots (RecordFile::insert) before the
+//   file grows, should a file carry any
+// - Phone numbers are indexed (normalised to digits) by slot; the index is
+//   built by one scan on the first phone lookup, then kept in step with
+//   every insert
 //
 // Revision History:
 // Rev. 2 - 2025/08/05 - Updated to use fixed-size records for persistence
+// Rev. 3 - 2025/08/23 - Mirrored license keys for vectorised lookups
+// Rev. 4 - 2025/08/26 - Records read and written through RecordSchema
+// Rev. 5 - 2025/08/27 - Versioned file header (RecordFile)
+// Rev. 6 - 2025/08/28 - Deleted vehicles free their slot for reuse
+// Rev. 7 - 2025/08/31 - Key column restored from the startup checkpoint
+// Rev. 8 - 2025/09/01 - Bloom filter in front of the key column
+// Rev. 9 - 2025/09/01 - Phone number index and findLicensesByPhone
+// Rev. 10 - 2025/09/02 - getVehiclePhone
+// Rev. 11 - 2025/09/02 - flush, for the checkpoint
+// Rev. 12 - 2025/09/02 - deleteVehicle removed; it orphaned reservations
 
 #include "vehicle_io.h"
+#include "stats.h"
+#include "keys.h"
+#include "record_file.h"
+#include "checkpoint.h"
+#include "bloom.h"
+#include "record_block.h"
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <cctype>
 #include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 // Private constants
-static const std::string VEHICLE_FILE_NAME = "vehicles.dat";
-static const size_t LICENSE_LENGTH    = 20; // Fixed length for license plate storage
-static const size_t PHONE_LENGTH      = 15; // Fixed length for phone number storage
-
-// Private file structure for binary storage
-#pragma pack(push, 1)
-struct VehicleRecord {
-    char   license[LICENSE_LENGTH];
-    char   phone[PHONE_LENGTH];
-    float  height;
-    float  length;
-    bool   isSpecial;
-};
-#pragma pack(pop)
+static const size_t KEY_LENGTH = 32;     // License key width in the key column
 
 // Private module variables
-static std::fstream vehicleFile;
+static RecordFile    file("vehicles.dat", RecordFile::formatOf<VehicleRecord>());
+static std::fstream& vehicleFile = file.stream();
 static bool fileIsOpen = false;
 
+// License of record i, zero-padded to KEY_LENGTH bytes. Mirrors vehicles.dat
+// so lookups compare one key per vector instruction instead of reading and
+// strncmp'ing every 44-byte record. A probe of LICENSE_LENGTH characters or
+// more never matches, as with the strncmp(..., LICENSE_LENGTH) it replaces.
+static_assert(sizeof(LicenseKey) == KEY_LENGTH, "license keys must fill one vector");
+static_assert(VehicleIO::CHECKPOINT_ROW == KEY_LENGTH, "checkpoint rows are license keys");
+static std::vector<LicenseKey> licenseKeys;
+
+// Every key in licenseKeys
+static BloomFilter licenseFilter;
+
+// Refills licenseFilter from the key column.
+static void rebuildFilter() {
+    licenseFilter.reset(licenseKeys.size());
+    for (const LicenseKey& key : licenseKeys)
+        if (!key.empty()) licenseFilter.add(key.view());
+}
+
+// Slots of the vehicles registered to each normalised phone number, in
+// ascending order. Empty until the first phone lookup builds it.
+static std::unordered_map<std::string, std::vector<size_t>> phoneSlots;
+static bool phoneIndexBuilt = false;
+
+static void indexPhone(const VehicleRecord& rec, size_t slot) {
+    std::string phone = VehicleIO::normalisePhone(fieldView(rec.phone));
+    if (phone.empty()) return;
+    std::vector<size_t>& slots = phoneSlots[phone];
+    slots.insert(std::lower_bound(slots.begin(), slots.end(), slot), slot);
+}
+
+// Fills phoneSlots from vehicles.dat, a block at a time.
+static void buildPhoneIndex() {
+    phoneSlots.clear();
+    RecordScanner<VehicleRecord> scan(file);
+    while (scan.nextBlock()) {
+        for (size_t i = 0; i < scan.size(); ++i)
+            if (RecordFile::isLive(scan[i])) indexPhone(scan[i], scan.firstSlot() + i);
+    }
+    phoneIndexBuilt = true;
+}
+
+// Returns the record position of `key`, or -1 if no vehicle has it.
+static long findKey(const LicenseKey& key) {
+    const LicenseKey* keys = licenseKeys.data();
+    const size_t n = licenseKeys.size();
+#if defined(__AVX2__)
+    const __m256i probe = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key.data()));
+    for (size_t i = 0; i < n; ++i) {
+        __m256i k = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys[i].data()));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(k, probe)) == -1)
+            return static_cast<long>(i);
+    }
+#elif defined(__SSE2__)
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key.data()));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(key.data() + 16));
+    for (size_t i = 0; i < n; ++i) {
+        const __m128i* k = reinterpret_cast<const __m128i*>(keys[i].data());
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(k), lo),
+                                   _mm_cmpeq_epi8(_mm_loadu_si128(k + 1), hi));
+        if (_mm_movemask_epi8(eq) == 0xFFFF)
+            return static_cast<long>(i);
+    }
+#elif defined(__ARM_NEON)
+    const uint8x16_t lo = vld1q_u8(reinterpret_cast<const uint8_t*>(key.data()));
+    const uint8x16_t hi = vld1q_u8(reinterpret_cast<const uint8_t*>(key.data() + 16));
+    for (size_t i = 0; i < n; ++i) {
+        const uint8_t* k = reinterpret_cast<const uint8_t*>(keys[i].data());
+        uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(k), lo), vceqq_u8(vld1q_u8(k + 16), hi));
+        if (vminvq_u8(eq) == 0xFF)
+            return static_cast<long>(i);
+    }
+#else
+    for (size_t i = 0; i < n; ++i)
+        if (keys[i] == key)
+            return static_cast<long>(i);
+#endif
+    return -1;
+}
+
+// findKey behind the filter, which rules out most absent keys without a scan.
+static long lookupKey(const LicenseKey& key) {
+    if (!licenseFilter.mayContain(key.view())) return -1;
+    return findKey(key);
+}
+
+// Fills the key column from vehicles.dat in one sequential pass, projecting
+// the license field out of each encoded record without decoding the rest.
+static bool loadKeys() {
+    constexpr size_t recSize  = RecordSchema<VehicleRecord>::SIZE;
+    constexpr size_t licField = schema::fieldIndex<VehicleRecord>("license");
+    static_assert(licField < schema::fieldCount<VehicleRecord>(), "license field");
+
+    licenseKeys.clear();
+    size_t count = file.slotCount();
+    std::vector<char> bytes(count * recSize);
+    file.rewind();
+    if (count > 0) {
+        vehicleFile.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        STATS_READ(bytes.size(), count);
+        if (!vehicleFile) return false;
+    }
+    licenseKeys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        licenseKeys.push_back(LicenseKey(
+            schema::projectText<VehicleRecord>(bytes.data() + i * recSize, licField)));
+    return true;
+}
+
+// Fills the key column from the checkpoint if vehicles.dat has not
+// changed since it was written.
+static bool restoreKeys() {
+    Checkpoint::View view;
+    if (!Checkpoint::isCurrent("vehicles.dat")
+     || !Checkpoint::section(Checkpoint::LICENSE_KEYS, KEY_LENGTH, view)
+     || view.rows != file.slotCount())
+        return false;
+    licenseKeys.resize(view.rows);
+    std::memcpy(licenseKeys.data(), view.data, view.rows * KEY_LENGTH);
+    return true;
+}
+
+// Reads the record in `slot`.
+static bool readSlot(size_t slot, VehicleRecord& out) {
+    vehicleFile.clear();
+    vehicleFile.seekg(file.slotOffset(slot), std::ios::beg);
+    schema::readRecord(vehicleFile, out);
+    STATS_READ(sizeof(out));
+    return static_cast<bool>(vehicleFile);
+}
+
+// Looks up `license` in the key column and reads its record.
+static bool findVehicle(std::string_view license, VehicleRecord& out) {
+    if (!fileIsOpen || license.empty()) return false;
+    long slot = lookupKey(LicenseKey(license));
+    return slot >= 0 && readSlot(static_cast<size_t>(slot), out);
+}
+
+// Writes `record` into a free slot (or the end of the file) and records
+// its key at the same position.
+static bool insertRecord(const VehicleRecord& record) {
+    size_t slot;
+    if (!file.insert(record, slot)) return false;
+    if (slot == licenseKeys.size()) licenseKeys.push_back(LicenseKey(record.license));
+    else                            licenseKeys[slot] = LicenseKey(record.license);
+    licenseFilter.add(licenseKeys[slot].view());
+    if (licenseFilter.needsRebuild()) rebuildFilter();
+    if (phoneIndexBuilt) indexPhone(record, slot);
+    return true;
+}
+
 bool VehicleIO::open() {
     if (fileIsOpen) return true;
-    // try open existing
-    vehicleFile.open(VEHICLE_FILE_NAME,
-                     std::ios::in | std::ios::out | std::ios::binary);
-    if (!vehicleFile) {
-        // create then reopen
-        vehicleFile.open(VEHICLE_FILE_NAME,
-                         std::ios::out | std::ios::binary);
-        if (!vehicleFile) return false;
-        vehicleFile.close();
-        vehicleFile.open(VEHICLE_FILE_NAME,
-                         std::ios::in | std::ios::out | std::ios::binary);
-        if (!vehicleFile) return false;
+    if (!file.open()) return false;
+    if (!restoreKeys() && !loadKeys()) {
+        file.close();
+        return false;
     }
+    rebuildFilter();
     fileIsOpen = true;
     return true;
 }
 
+bool VehicleIO::flush() {
+    return file.flush();
+}
+
 void VehicleIO::close() {
     if (fileIsOpen) {
-        vehicleFile.close();
+        file.close();
+        licenseKeys.clear();
+        licenseFilter = BloomFilter();
+        phoneSlots.clear();
+        phoneIndexBuilt = false;
         fileIsOpen = false;
     }
 }
 
+size_t VehicleIO::saveCheckpoint(std::vector<char>& out) {
+    const size_t bytes = licenseKeys.size() * KEY_LENGTH;
+    out.insert(out.end(), reinterpret_cast<const char*>(licenseKeys.data()),
+               reinterpret_cast<const char*>(licenseKeys.data()) + bytes);
+    return licenseKeys.size();
+}
+
 void VehicleIO::reset() {
     if (fileIsOpen) {
-        vehicleFile.clear();
-        vehicleFile.seekg(0, std::ios::beg);
+        file.rewind();
     }
 }
 
-bool VehicleIO::checkVehicleExists(const std::string& license) {
+bool VehicleIO::checkVehicleExists(std::string_view license) {
+    STATS_SCOPE(VEHICLE_IO_LOOKUP);
     if (!fileIsOpen || license.empty()) return false;
-    reset();
-    VehicleRecord record;
-    while (vehicleFile.read(reinterpret_cast<char*>(&record), sizeof(record))) {
-        // compare only up to null-terminator
-        if (std::strncmp(record.license, license.c_str(), LICENSE_LENGTH) == 0) {
-            return true;
-        }
-    }
-    return false;
+    return lookupKey(LicenseKey(license)) >= 0;
 }
 
-bool VehicleIO::checkVehicleIsSpecial(const std::string& license) {
-    if (!fileIsOpen || license.empty()) return false;
-    reset();
+bool VehicleIO::checkVehicleIsSpecial(std::string_view license) {
+    STATS_SCOPE(VEHICLE_IO_LOOKUP);
     VehicleRecord rec;
-    while (vehicleFile.read(reinterpret_cast<char*>(&rec), sizeof(rec))) {
-        if (std::strncmp(rec.license, license.c_str(), LICENSE_LENGTH) == 0)
-            return rec.isSpecial;
-    }
-    return false;
+    return findVehicle(license, rec) && rec.isSpecial;
 }
 
-bool VehicleIO::getVehicleDimensions(const std::string& license,
+bool VehicleIO::getVehicleDimensions(std::string_view license,
                                      float& outHeight,
                                      float& outLength) {
-    if (!fileIsOpen || license.empty()) return false;
-    reset();
+    STATS_SCOPE(VEHICLE_IO_LOOKUP);
     VehicleRecord rec;
-    while (vehicleFile.read(reinterpret_cast<char*>(&rec), sizeof(rec))) {
-        if (std::strncmp(rec.license, license.c_str(), LICENSE_LENGTH) == 0) {
-            outHeight = rec.height;
-            outLength = rec.length;
-            return true;
-        }
-    }
-    return false;
+    if (!findVehicle(license, rec)) return false;
+    outHeight = toMetres(rec.heightCm);
+    outLength = toMetres(rec.lengthCm);
+    return true;
 }
 
+bool VehicleIO::getVehiclePhone(std::string_view license, std::string& outPhone) {
+    STATS_SCOPE(VEHICLE_IO_LOOKUP);
+    VehicleRecord rec;
+    if (!findVehicle(license, rec)) return false;
+    outPhone.assign(fieldView(rec.phone));
+    return true;
+}
 
 bool VehicleIO::createSpecialVehicle(const Vehicle& vehicle) {
+    STATS_SCOPE(VEHICLE_IO_CREATE);
     if (!fileIsOpen) return false;
     VehicleRecord record;
     std::memset(&record, 0, sizeof(record));
     // copy fields with safety
     std::strncpy(record.license, vehicle.currentLicensePlate.c_str(), LICENSE_LENGTH - 1);
     std::strncpy(record.phone, vehicle.currentPhoneNumber.c_str(), PHONE_LENGTH - 1);
-    record.height    = vehicle.currentHeight;
-    record.length    = vehicle.currentLength;
+    record.heightCm  = toCentimetres(vehicle.currentHeight);
+    record.lengthCm  = toCentimetres(vehicle.currentLength);
     record.isSpecial = true;
-    vehicleFile.clear();
-    vehicleFile.seekp(0, std::ios::end);
-    vehicleFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
-    return vehicleFile.good();
+    return insertRecord(record);
 }
 
 bool VehicleIO::createVehicle(const Vehicle& vehicle) {
+    STATS_SCOPE(VEHICLE_IO_CREATE);
     if (!fileIsOpen) return false;
     VehicleRecord record;
     std::memset(&record, 0, sizeof(record));
     std::strncpy(record.license, vehicle.currentLicensePlate.c_str(), LICENSE_LENGTH - 1);
     std::strncpy(record.phone, vehicle.currentPhoneNumber.c_str(), PHONE_LENGTH - 1);
-    record.height    = 0.0f;
-    record.length    = 0.0f;
+    record.heightCm  = 0;
+    record.lengthCm  = 0;
     record.isSpecial = false;
-    vehicleFile.clear();
-    vehicleFile.seekp(0, std::ios::end);
-    vehicleFile.write(reinterpret_cast<const char*>(&record), sizeof(record));
-    return vehicleFile.good();
+    return insertRecord(record);
+}
+
+std::string VehicleIO::normalisePhone(std::string_view phone) {
+    std::string digits;
+    for (char c : phone)
+        if (std::isdigit(static_cast<unsigned char>(c))) digits.push_back(c);
+    // a leading country code 1 on a ten-digit number
+    if (digits.size() == 11 && digits[0] == '1') digits.erase(0, 1);
+    return digits;
+}
+
+bool VehicleIO::findLicensesByPhone(std::string_view phone, std::vector<LicenseKey>& out) {
+    STATS_SCOPE(VEHICLE_IO_LOOKUP);
+    out.clear();
+    if (!fileIsOpen) return false;
+    if (!phoneIndexBuilt) buildPhoneIndex();
+    auto it = phoneSlots.find(normalisePhone(phone));
+    if (it == phoneSlots.end()) return false;
+    for (size_t slot : it->second) out.push_back(licenseKeys[slot]);
+    return true;
 }
@@ -9,13 +9,65 @@
 // Rev. 1 - 2025/07/07 - Team 12
 // Rev. 2 - 2025/07/16 - Team 12
 // - Converted to class format with all file I/O operations
+// Rev. 3 - 2025/08/28 - Team 12
+// - deleteVehicle; freed slots are reused by the create calls
+// Rev. 4 - 2025/08/31 - Team 12
+// - License key column saved to and restored from the checkpoint
+// Rev. 5 - 2025/09/01 - Team 12
+// - findLicensesByPhone and normalisePhone
+// Rev. 6 - 2025/09/02 - Team 12
+// - getVehiclePhone
+// Rev. 7 - 2025/09/02 - Team 12
+// - flush
+// Rev. 8 - 2025/09/02 - Team 12
+// - deleteVehicle removed: nothing but the benchmark called it, and it
+//   freed vehicles that reservations still referred to
 //*******************************
 
 #pragma once
 #include "vehicle.h"
+#include "units.h"
+#include "schema.h"
+#include "keys.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static const size_t LICENSE_LENGTH = 20; // Fixed length for license plate storage
+static const size_t PHONE_LENGTH   = 15; // Fixed length for phone number storage
+
+// Fixed-length binary record layout for a vehicle (vehicles.dat)
+#pragma pack(push, 1)
+struct VehicleRecord {
+    char   license[LICENSE_LENGTH];
+    char   phone[PHONE_LENGTH];
+    Centimetres heightCm;
+    Centimetres lengthCm;
+    bool   isSpecial;
+};
+#pragma pack(pop)
+
+template <>
+struct RecordSchema<VehicleRecord> {
+    static constexpr const char*   NAME    = "vehicle";
+    static constexpr uint32_t      VERSION = 2;
+    static constexpr uint32_t      SIZE    = 44;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(VehicleRecord, license,   schema::Type::Text,   0, LICENSE_LENGTH),
+        SCHEMA_FIELD(VehicleRecord, phone,     schema::Type::Text,  20, PHONE_LENGTH),
+        SCHEMA_FIELD(VehicleRecord, heightCm,  schema::Type::Int32, 35, 4),
+        SCHEMA_FIELD(VehicleRecord, lengthCm,  schema::Type::Int32, 39, 4),
+        SCHEMA_FIELD(VehicleRecord, isSpecial, schema::Type::Bool,  43, 1),
+    };
+};
+static_assert(schema::layoutMatches<VehicleRecord>(), "VehicleRecord does not match vehicles.dat");
 
 class VehicleIO {
 public:
+    // Bytes per license key in the checkpoint
+    static const size_t CHECKPOINT_ROW = 32;
+
     //------
     // Description:
     // Opens the vehicle data file. Returns true if successful.
@@ -30,6 +82,14 @@ public:
     // File must be open
     static void close();
 
+    //------
+    // Description:
+    // Pushes buffered writes to the vehicle data file. Returns true if
+    // successful.
+    // Precondition:
+    // None
+    static bool flush();
+
     //------
     // Description:
     // Resets the file iterator to beginning of file.
@@ -43,16 +103,20 @@ public:
     // Precondition:
     // File must be open
     static bool checkVehicleExists(
-        const std::string& license  // [in] Vehicle license to check
+        std::string_view license  // [in] Vehicle license to check
     );
 
     // returns true if this license exists *and* was stored as a special vehicle
-    static bool checkVehicleIsSpecial(const std::string& license);
+    static bool checkVehicleIsSpecial(std::string_view license);
+
+    // Returns true and fills height/length (metres) if the vehicle exists.
+    static bool getVehicleDimensions(std::string_view license,
+                                     float& outHeight,
+                                     float& outLength);
 
-    // Returns true and fills height/length if the vehicle exists.
-    static bool getVehicleDimensions(const std::string& license,
-                                 float& outHeight,
-                                 float& outLength);
+    // Returns true and fills `outPhone` as stored if the vehicle exists.
+    static bool getVehiclePhone(std::string_view license,
+                                std::string& outPhone);
 
 
     //------
@@ -73,6 +137,35 @@ public:
         const Vehicle& vehicle  // [in] Vehicle to create
     );
 
+    //------
+    // Description:
+    // Fills `out` with the licenses of every vehicle registered to
+    // `phone`, in file order. Phone numbers are compared normalised (see
+    // normalisePhone). Returns true if there is at least one.
+    // Precondition:
+    // File must be open
+    static bool findLicensesByPhone(
+        std::string_view phone,        // [in] Phone number, any punctuation
+        std::vector<LicenseKey>& out   // [out] Licenses registered to it
+    );
+
+    //------
+    // Description:
+    // Returns the digits of `phone`, without a leading country code 1 on
+    // an eleven-digit number, so "604-555-0100", "(604) 555 0100" and
+    // "+1 604 555 0100" compare equal.
+    // Precondition:
+    // None
+    static std::string normalisePhone(std::string_view phone);
+
+    //------
+    // Description:
+    // Appends the license key column to `out` in checkpoint layout and
+    // returns the number of keys.
+    // Precondition:
+    // None
+    static size_t saveCheckpoint(std::vector<char>& out);
+
 private:
     // Private implementation details
     // std::fstream vehicleFile;
@@ -4,28 +4,34 @@
 #include "vessel.h"
 #include "vessel_io.h"
 #include "sailing.h"
+#include "stats.h"
+#include "trace.h"
 #include <iostream>
+#include <algorithm>
 #include <cstring>
 
-void Vessel::init() {
+bool Vessel::init() {
     if (!VesselIO::open()) {
         std::cerr << "Error: Unable to open vessel data file\n";
-    } else {
-        VesselIO::reset();
+        return false;
     }
+    VesselIO::reset();
+    return true;
 }
 
 void Vessel::shutdown() {
     VesselIO::close();
 }
 
-bool Vessel::createVessel(const std::string& vesselName,
+bool Vessel::createVessel(std::string_view vesselName,
                           const int capacity,
                           const float highLaneLength,
                           const float lowLaneLength)
 {
+    STATS_SCOPE(CREATE_VESSEL);
+    Trace::recordCreateVessel(vesselName, capacity, highLaneLength, lowLaneLength);
     // prevent duplicates
-    if (VesselIO::checkVesselExists(vesselName.c_str())) {
+    if (VesselIO::checkVesselExists(vesselName)) {
         return false;
     }
 
@@ -49,11 +55,12 @@ bool Vessel::createVessel(const std::string& vesselName,
 
     // build record
     VesselRecord rec;
-    std::strncpy(rec.vesselName, vesselName.c_str(), sizeof(rec.vesselName));
-    rec.vesselName[sizeof(rec.vesselName)-1] = '\0';
+    std::memset(rec.vesselName, 0, sizeof(rec.vesselName));
+    std::memcpy(rec.vesselName, vesselName.data(),
+                std::min(vesselName.size(), sizeof(rec.vesselName) - 1));
     rec.maxPassengers   = capacity;  // Directly use the parameter
-    rec.highLaneLength  = highLaneLength;  // Directly use the parameter
-    rec.lowLaneLength   = lowLaneLength;  // Directly use the parameter
+    rec.highLaneCm      = toCentimetres(highLaneLength);
+    rec.lowLaneCm       = toCentimetres(lowLaneLength);
 
     // persist
     if (!VesselIO::createVessel(rec)) {
@@ -64,8 +71,10 @@ bool Vessel::createVessel(const std::string& vesselName,
     return true;
 }
 
-bool Vessel::deleteVessel(const std::string& vesselName)
+bool Vessel::deleteVessel(std::string_view vesselName)
 {
+    STATS_SCOPE(DELETE_VESSEL);
+    Trace::recordDeleteVessel(vesselName);
     // 1) refuse if there are ANY sailings for this vessel
     if (Sailing::checkVesselHasSailings(vesselName)) {
         std::cerr << "Cannot delete vessel with scheduled sailings: "
@@ -74,7 +83,7 @@ bool Vessel::deleteVessel(const std::string& vesselName)
     }
 
     // 2) otherwise, proceed to delete from the vessels file
-    if (!VesselIO::deleteVessel(vesselName.c_str())) {
+    if (!VesselIO::deleteVessel(vesselName)) {
         std::cerr << "Error: Failed to delete vessel: " << vesselName << "\n";
         return false;
     }
@@ -82,17 +91,17 @@ bool Vessel::deleteVessel(const std::string& vesselName)
     return true;
 }
 
-bool Vessel::checkVesselForSailing(const std::string& vesselName)
+bool Vessel::checkVesselForSailing(std::string_view vesselName)
 {
-    return VesselIO::checkVesselExists(vesselName.c_str());
+    return VesselIO::checkVesselExists(vesselName);
 }
 
-bool Vessel::getLRL(const std::string& vesselName, float& outLRL)
+bool Vessel::getLRL(std::string_view vesselName, Centimetres& outLRL)
 {
-    return VesselIO::getLRL(vesselName.c_str(), outLRL);
+    return VesselIO::getLRL(vesselName, outLRL);
 }
 
-bool Vessel::getHRL(const std::string& vesselName, float& outHRL)
+bool Vessel::getHRL(std::string_view vesselName, Centimetres& outHRL)
 {
-    return VesselIO::getHRL(vesselName.c_str(), outHRL);
+    return VesselIO::getHRL(vesselName, outHRL);
 }
\ No newline at end of file
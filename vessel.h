@@ -3,13 +3,15 @@
 #ifndef VESSEL_H
 #define VESSEL_H
 
-#include <string>
+#include <string_view>
+#include "units.h"
 
 /// Domain‐level API for ferry vessels.
 class Vessel {
 public:
-    /// Open underlying storage (called during startup).
-    static void init();
+    /// Open underlying storage (called during startup); false if it
+    /// cannot be opened.
+    static bool init();
 
     /// Close underlying storage (called during shutdown).
     static void shutdown();
@@ -22,7 +24,7 @@ public:
      * @param lowLaneLength   Low‑ceiling lane length (as string).
      * @return true if creation succeeded.
      */
-    static bool createVessel(const std::string& vesselName,
+    static bool createVessel(std::string_view vesselName,
                              const int capacity,
                              const float highLaneLength,
                              const float lowLaneLength);
@@ -32,30 +34,30 @@ public:
      * @param vesselName  Name/ID of the vessel to delete.
      * @return true if deletion succeeded.
      */
-    static bool deleteVessel(const std::string& vesselName);
+    static bool deleteVessel(std::string_view vesselName);
 
     /**
      * Check whether the given vessel has any scheduled sailings.
      * @param vesselName  Name/ID of the vessel to check.
      * @return true if the vessel has NO sailings (i.e. safe to delete).
      */
-    static bool checkVesselForSailing(const std::string& vesselName);
+    static bool checkVesselForSailing(std::string_view vesselName);
 
     /**
      * Get the Low‑ceiling Lane Length (LRL) specification for a vessel.
      * @param vesselName  Name/ID to lookup.
-     * @param outLRL      [out] the low‑ceiling lane length.
+     * @param outLRL      [out] the low‑ceiling lane length in cm.
      * @return true if vessel exists and outLRL is set.
      */
-    static bool getLRL(const std::string& vesselName, float& outLRL);
+    static bool getLRL(std::string_view vesselName, Centimetres& outLRL);
 
     /**
      * Get the High‑ceiling Lane Length (HRL) specification for a vessel.
      * @param vesselName  Name/ID to lookup.
-     * @param outHRL      [out] the high‑ceiling lane length.
+     * @param outHRL      [out] the high‑ceiling lane length in cm.
      * @return true if vessel exists and outHRL is set.
      */
-    static bool getHRL(const std::string& vesselName, float& outHRL);
+    static bool getHRL(std::string_view vesselName, Centimetres& outHRL);
 };
 
 #endif // VESSEL_H
\ No newline at end of file
@@ -2,135 +2,160 @@
 // VesselIO.cpp
 
 #include "vessel_io.h"
+#include "stats.h"
+#include "keys.h"
+#include "record_file.h"
+#include "record_block.h"
+#include "bloom.h"
+#include "checkpoint.h"
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <cstring>
 
-/// Path to the binary vessel file
-static constexpr const char* kVesselFileName = "vessels.dat";
+/// The binary vessel file and its stream
+static RecordFile    file("vessels.dat", RecordFile::formatOf<VesselRecord>());
+static std::fstream& fs = file.stream();
 
-/// Define the static file stream
-std::fstream VesselIO::fs;
+/// Names of the vessels in the file, so unknown names skip the scan
+static BloomFilter names;
+
+/// Refills the name filter from `all`, the whole file
+static void fillNames(const std::vector<VesselRecord>& all) {
+    names.reset(all.size());
+    for (const VesselRecord& rec : all) names.add(fieldView(rec.vesselName));
+}
+
+/// Refills the name filter from the file
+static bool loadNames() {
+    std::vector<VesselRecord> all;
+    if (!VesselIO::readAllVessels(all)) return false;
+    fillNames(all);
+    return true;
+}
+
+/// Takes the name filter from the checkpoint if vessels.dat has not
+/// changed since it was written
+static bool restoreNames() {
+    Checkpoint::View view;
+    return Checkpoint::isCurrent("vessels.dat")
+        && Checkpoint::section(Checkpoint::VESSEL_NAMES, BloomFilter::CHECKPOINT_ROW, view)
+        && names.restore(view.data, view.rows);
+}
 
 bool VesselIO::open() {
-    // Try to open existing file
-    fs.open(kVesselFileName, std::ios::in | std::ios::out | std::ios::binary);
-    if (!fs.is_open()) {
-        // If it doesn't exist yet, create it
-        fs.clear();
-        fs.open(kVesselFileName, std::ios::out | std::ios::binary);
-        if (!fs) {
-            std::cerr << "VesselIO::open — failed to create file " << kVesselFileName << "\n";
-            return false;
-        }
-        fs.close();
-        // Reopen for read/write
-        fs.open(kVesselFileName, std::ios::in | std::ios::out | std::ios::binary);
-        if (!fs) {
-            std::cerr << "VesselIO::open — failed to reopen file " << kVesselFileName << "\n";
-            return false;
-        }
+    if (!file.open()) {
+        std::cerr << "VesselIO::open — failed to open " << file.path() << "\n";
+        return false;
     }
-    reset();
-    return true;
+    return restoreNames() || loadNames();
+}
+
+size_t VesselIO::saveCheckpoint(std::vector<char>& out) {
+    return names.save(out);
 }
 
 void VesselIO::reset() {
-    fs.clear();
-    fs.seekg(0, std::ios::beg);
-    fs.seekp(0, std::ios::beg);
+    file.rewind();
+}
+
+bool VesselIO::flush() {
+    return file.flush();
 }
 
 void VesselIO::close() {
-    if (fs.is_open()) fs.close();
+    file.close();
+    names = BloomFilter();
 }
 
 bool VesselIO::createVessel(const VesselRecord& rec) {
+    STATS_SCOPE(VESSEL_IO_CREATE);
     fs.clear();
     fs.seekp(0, std::ios::end);
-    fs.write(reinterpret_cast<const char*>(&rec), sizeof rec);
-    if (!fs) {
+    schema::writeRecord(fs, rec);
+    STATS_WRITE(sizeof rec);
+    if (!fs || !file.addLive(1)) {
         std::cerr << "VesselIO::createVessel — write failed\n";
         return false;
     }
     fs.flush();
+    STATS_FLUSH();
     if (!fs) {
         std::cerr << "VesselIO::createVessel — flush failed\n";
         return false;
     }
+    names.add(fieldView(rec.vesselName));
+    if (names.needsRebuild()) loadNames();
     return true;
 }
 
-bool VesselIO::readVessel(const char* vesselName, VesselRecord& rec) {
-    fs.clear();
-    fs.seekg(0, std::ios::beg);
-    while (fs.read(reinterpret_cast<char*>(&rec), sizeof rec)) {
-        if (std::strncmp(rec.vesselName, vesselName, sizeof rec.vesselName) == 0) {
-            return true;
+bool VesselIO::readVessel(std::string_view vesselName, VesselRecord& rec) {
+    STATS_SCOPE(VESSEL_IO_READ);
+    if (!names.mayContain(vesselName)) return false;
+    RecordScanner<VesselRecord> scan(file);
+    while (scan.nextBlock()) {
+        for (const VesselRecord& r : scan) {
+            if (fieldView(r.vesselName) == vesselName) {
+                rec = r;
+                return true;
+            }
         }
     }
     return false;
 }
 
-bool VesselIO::checkVesselExists(const char* vesselName) {
+bool VesselIO::readAllVessels(std::vector<VesselRecord>& out) {
+    STATS_SCOPE(VESSEL_IO_READ_ALL);
+    if (!file.isOpen()) return false;
+    out.resize(file.slotCount());
+    reset();
+    if (!out.empty()) {
+        bool ok = schema::readRecords(fs, out.data(), out.size());
+        STATS_READ(out.size() * sizeof(VesselRecord), out.size());
+        if (!ok) {
+            std::cerr << "VesselIO::readAllVessels — read failed\n";
+            out.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VesselIO::checkVesselExists(std::string_view vesselName) {
     VesselRecord tmp;
     return readVessel(vesselName, tmp);
 }
 
-bool VesselIO::deleteVessel(const char* vesselName) {
+bool VesselIO::deleteVessel(std::string_view vesselName) {
+    STATS_SCOPE(VESSEL_IO_DELETE);
+    if (!names.mayContain(vesselName)) return false;
     // Read all records except the one to delete
-    fs.clear();
-    fs.seekg(0, std::ios::beg);
     std::vector<VesselRecord> all;
-    VesselRecord rec;
-    bool found = false;
-
-    while (fs.read(reinterpret_cast<char*>(&rec), sizeof rec)) {
-        if (std::strncmp(rec.vesselName, vesselName, sizeof rec.vesselName) == 0) {
-            found = true;
-            continue;
-        }
-        all.push_back(rec);
-    }
-    if (!found) return false;
+    if (!readAllVessels(all)) return false;
+    auto named = [&](const VesselRecord& r) { return fieldView(r.vesselName) == vesselName; };
+    auto gone = std::remove_if(all.begin(), all.end(), named);
+    if (gone == all.end()) return false;
+    all.erase(gone, all.end());
 
-    // Truncate and rewrite
-    fs.close();
-    fs.open(kVesselFileName, std::ios::out | std::ios::binary | std::ios::trunc);
-    if (!fs) {
-        std::cerr << "VesselIO::deleteVessel — truncate failed\n";
+    // Rewrite through a temporary file; the old file survives a failure
+    if (!file.replaceAll(all)) {
+        std::cerr << "VesselIO::deleteVessel — rewrite failed\n";
         return false;
     }
-    for (const auto& r : all) {
-        fs.write(reinterpret_cast<const char*>(&r), sizeof r);
-        if (!fs) {
-            std::cerr << "VesselIO::deleteVessel — write failed during rewrite\n";
-            return false;
-        }
-    }
-    fs.flush();
-    fs.close();
-
-    // Reopen for regular use
-    fs.open(kVesselFileName, std::ios::in | std::ios::out | std::ios::binary);
-    if (!fs) {
-        std::cerr << "VesselIO::deleteVessel — reopen failed\n";
-        return false;
-    }
-    reset();
+    fillNames(all);
     return true;
 }
 
-bool VesselIO::getLRL(const char* vesselName, float& outLRL) {
+bool VesselIO::getLRL(std::string_view vesselName, Centimetres& outLRL) {
     VesselRecord rec;
     if (!readVessel(vesselName, rec)) return false;
-    outLRL = rec.lowLaneLength;
+    outLRL = rec.lowLaneCm;
     return true;
 }
 
-bool VesselIO::getHRL(const char* vesselName, float& outHRL) {
+bool VesselIO::getHRL(std::string_view vesselName, Centimetres& outHRL) {
     VesselRecord rec;
     if (!readVessel(vesselName, rec)) return false;
-    outHRL = rec.highLaneLength;
+    outHRL = rec.highLaneCm;
     return true;
 }
\ No newline at end of file
@@ -3,33 +3,55 @@
 #ifndef VESSEL_IO_H
 #define VESSEL_IO_H
 
+#include <cstddef>
 #include <fstream>
+#include <string_view>
+#include <vector>
+#include "units.h"
+#include "schema.h"
 
 /// Fixed‑length binary record layout for a vessel.
 struct VesselRecord {
     char   vesselName[30];
     int    maxPassengers;
-    float  highLaneLength;
-    float  lowLaneLength;
+    Centimetres highLaneCm;
+    Centimetres lowLaneCm;
 };
 
+template <>
+struct RecordSchema<VesselRecord> {
+    static constexpr const char*   NAME    = "vessel";
+    static constexpr uint32_t      VERSION = 2;
+    static constexpr uint32_t      SIZE    = 44;
+    static constexpr schema::Field FIELDS[] = {
+        SCHEMA_FIELD(VesselRecord, vesselName,    schema::Type::Text,   0, 30),
+        SCHEMA_FIELD(VesselRecord, maxPassengers, schema::Type::Int32, 32,  4),
+        SCHEMA_FIELD(VesselRecord, highLaneCm,    schema::Type::Int32, 36,  4),
+        SCHEMA_FIELD(VesselRecord, lowLaneCm,     schema::Type::Int32, 40,  4),
+    };
+};
+static_assert(schema::layoutMatches<VesselRecord>(), "VesselRecord does not match vessels.dat");
+
 class VesselIO {
 public:
     static bool open();
     static void reset();
     static void close();
+    static bool flush();   // push buffered writes to vessels.dat
+
+    // Appends the vessel name filter to `out` in checkpoint layout
+    // (BloomFilter::save) and returns the number of rows
+    static size_t saveCheckpoint(std::vector<char>& out);
 
     static bool createVessel(const VesselRecord& rec);
-    static bool deleteVessel(const char* vesselName);
-    static bool checkVesselExists(const char* vesselName);
-    static bool readVessel(const char* vesselName, VesselRecord& rec);
+    static bool deleteVessel(std::string_view vesselName);
+    static bool checkVesselExists(std::string_view vesselName);
+    static bool readVessel(std::string_view vesselName, VesselRecord& rec);
+    static bool readAllVessels(std::vector<VesselRecord>& out);
 
     // just declarations here:
-    static bool getLRL(const char* vesselName, float& outLRL);
-    static bool getHRL(const char* vesselName, float& outHRL);
-
-private:
-    static std::fstream fs;
+    static bool getLRL(std::string_view vesselName, Centimetres& outLRL);
+    static bool getHRL(std::string_view vesselName, Centimetres& outHRL);
 };
 
 #endif // VESSELIO_H
\ No newline at end of file